@@ -103,16 +103,22 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Prefetch all read heads, the reads are issued as a single batch so they can be in flight at the same time
 	void Prefetch() {
+		vector<FileReadRequest> requests;
 		for (auto &read_head : read_heads) {
+			if (read_head.data_isset) {
+				continue;
+			}
 			read_head.Allocate(allocator);
 
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
-
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			requests.emplace_back(read_head.data.get(), read_head.size, read_head.location);
+		}
+		handle.ReadBatch(requests);
+		for (auto &read_head : read_heads) {
 			read_head.data_isset = true;
 		}
 	}
@@ -25,6 +25,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -829,6 +830,89 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+template <class T>
+void TemplatedInFilterOperation(Vector &v, const InFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	auto constants = FlatVector::GetData<T>(filter.sorted_values);
+	auto constant_count = filter.values.size();
+	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		auto v_ptr = ConstantVector::GetData<T>(v);
+		auto &mask = ConstantVector::Validity(v);
+
+		if (mask.RowIsValid(0)) {
+			if (!InFilter::Contains<T>(constants, constant_count, v_ptr[0])) {
+				filter_mask.reset();
+			}
+		}
+		return;
+	}
+
+	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto v_ptr = FlatVector::GetData<T>(v);
+	auto &mask = FlatVector::Validity(v);
+
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask[i] && mask.RowIsValid(i)) {
+			filter_mask[i] = InFilter::Contains<T>(constants, constant_count, v_ptr[i]);
+		}
+	}
+}
+
+static void InFilterOperationSwitch(Vector &v, const InFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	if (filter.values.empty()) {
+		filter_mask.reset();
+		return;
+	}
+	switch (v.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		TemplatedInFilterOperation<bool>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedInFilterOperation<uint8_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedInFilterOperation<uint16_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedInFilterOperation<uint32_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedInFilterOperation<uint64_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::INT8:
+		TemplatedInFilterOperation<int8_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedInFilterOperation<int16_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedInFilterOperation<int32_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedInFilterOperation<int64_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedInFilterOperation<hugeint_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedInFilterOperation<uhugeint_t>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedInFilterOperation<float>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedInFilterOperation<double>(v, filter, filter_mask, count);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedInFilterOperation<string_t>(v, filter, filter_mask, count);
+		break;
+	default:
+		throw NotImplementedException("Unsupported type for filter %s", v.ToString());
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -872,6 +956,9 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		}
 		break;
 	}
+	case TableFilterType::IN_FILTER:
+		InFilterOperationSwitch(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
 	case TableFilterType::IS_NOT_NULL:
 		FilterIsNotNull(v, filter_mask, count);
 		break;
@@ -32,6 +32,7 @@ def third_party_includes():
     includes += [os.path.join('third_party', 'tdigest')]
     includes += [os.path.join('third_party', 'utf8proc')]
     includes += [os.path.join('third_party', 'utf8proc', 'include')]
+    includes += [os.path.join('third_party', 'zstd', 'include')]
     return includes
 
 
@@ -47,6 +48,7 @@ def third_party_sources():
     sources += [os.path.join('third_party', 'utf8proc')]
     sources += [os.path.join('third_party', 'libpg_query')]
     sources += [os.path.join('third_party', 'mbedtls')]
+    sources += [os.path.join('third_party', 'zstd')]
     return sources
 
 
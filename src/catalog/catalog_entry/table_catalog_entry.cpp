@@ -21,7 +21,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), sort_key(std::move(info.sort_key)) {
 	this->temporary = info.temporary;
 	this->comment = info.comment;
 }
@@ -67,6 +67,7 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	std::for_each(constraints.begin(), constraints.end(),
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
+	result->sort_key = sort_key;
 	return std::move(result);
 }
 
@@ -181,6 +182,10 @@ const ColumnList &TableCatalogEntry::GetColumns() const {
 	return columns;
 }
 
+const vector<string> &TableCatalogEntry::GetSortKey() const {
+	return sort_key;
+}
+
 const ColumnDefinition &TableCatalogEntry::GetColumn(LogicalIndex idx) {
 	return columns.GetColumn(idx);
 }
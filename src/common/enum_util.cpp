@@ -120,6 +120,7 @@
 #include "duckdb/planner/bound_result_modifier.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer/eviction_policy.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
 #include "duckdb/storage/magic_bytes.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
@@ -1191,6 +1192,10 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
+	case CompressionType::COMPRESSION_DELTA_DELTA:
+		return "COMPRESSION_DELTA_DELTA";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1236,6 +1241,12 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
+	if (StringUtil::Equals(value, "COMPRESSION_DELTA_DELTA")) {
+		return CompressionType::COMPRESSION_DELTA_DELTA;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -1652,6 +1663,75 @@ ErrorType EnumUtil::FromString<ErrorType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<EvictionPolicyType>(EvictionPolicyType value) {
+	switch(value) {
+	case EvictionPolicyType::LRU:
+		return "LRU";
+	case EvictionPolicyType::TWO_QUEUE:
+		return "TWO_QUEUE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+EvictionPolicyType EnumUtil::FromString<EvictionPolicyType>(const char *value) {
+	if (StringUtil::Equals(value, "LRU")) {
+		return EvictionPolicyType::LRU;
+	}
+	if (StringUtil::Equals(value, "TWO_QUEUE")) {
+		return EvictionPolicyType::TWO_QUEUE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<EvictionPriority>(EvictionPriority value) {
+	switch(value) {
+	case EvictionPriority::NORMAL:
+		return "NORMAL";
+	case EvictionPriority::HIGH:
+		return "HIGH";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+EvictionPriority EnumUtil::FromString<EvictionPriority>(const char *value) {
+	if (StringUtil::Equals(value, "NORMAL")) {
+		return EvictionPriority::NORMAL;
+	}
+	if (StringUtil::Equals(value, "HIGH")) {
+		return EvictionPriority::HIGH;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<EvictionSegment>(EvictionSegment value) {
+	switch(value) {
+	case EvictionSegment::PROBATIONARY:
+		return "PROBATIONARY";
+	case EvictionSegment::PROTECTED:
+		return "PROTECTED";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+EvictionSegment EnumUtil::FromString<EvictionSegment>(const char *value) {
+	if (StringUtil::Equals(value, "PROBATIONARY")) {
+		return EvictionSegment::PROBATIONARY;
+	}
+	if (StringUtil::Equals(value, "PROTECTED")) {
+		return EvictionSegment::PROTECTED;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value) {
 	switch(value) {
@@ -6583,6 +6663,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6608,6 +6690,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6773,6 +6858,29 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TemporaryFileCompression>(TemporaryFileCompression value) {
+	switch(value) {
+	case TemporaryFileCompression::NONE:
+		return "NONE";
+	case TemporaryFileCompression::ZSTD:
+		return "ZSTD";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryFileCompression EnumUtil::FromString<TemporaryFileCompression>(const char *value) {
+	if (StringUtil::Equals(value, "NONE")) {
+		return TemporaryFileCompression::NONE;
+	}
+	if (StringUtil::Equals(value, "ZSTD")) {
+		return TemporaryFileCompression::ZSTD;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
@@ -361,11 +361,26 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Read (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 	// This is not a required method. Derived FileSystems may optionally override/implement.
 	return false;
 }
 
+data_ptr_t FileSystem::MapFile(FileHandle &handle, idx_t size) {
+	// This is not a required method. Derived FileSystems may optionally override/implement.
+	return nullptr;
+}
+
+void FileSystem::UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) {
+	throw NotImplementedException("%s: UnmapFile is not implemented!", GetName());
+}
+
 void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
@@ -568,6 +583,10 @@ void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+void FileHandle::ReadBatch(vector<FileReadRequest> &requests) {
+	file_system.ReadBatch(*this, requests);
+}
+
 void FileHandle::Seek(idx_t location) {
 	file_system.Seek(*this, location);
 }
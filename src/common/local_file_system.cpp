@@ -10,6 +10,10 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
+// the system headers below define macros that clash with names used in other files of the unity build
+#pragma push_macro("BLOCK_SIZE")
+#pragma push_macro("MAP_TYPE")
+
 #include <cstdint>
 #include <cstdio>
 #include <sys/stat.h>
@@ -18,6 +22,7 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <unistd.h>
 #else
@@ -57,6 +62,21 @@ extern "C" WINBASEAPI BOOL WINAPI GetPhysicallyInstalledSystemMemory(PULONGLONG)
 #include <restartmanager.h>
 #endif
 
+// io_uring is used for batches of reads on Linux, when the kernel headers are available
+#if defined(__linux__) && !defined(DUCKDB_DISABLE_IO_URING) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(IORING_FEAT_SINGLE_MMAP)
+#define DUCKDB_IO_URING
+#endif
+#endif
+#endif
+
+#pragma pop_macro("MAP_TYPE")
+#pragma pop_macro("BLOCK_SIZE")
+
 namespace duckdb {
 
 #ifndef _WIN32
@@ -493,6 +513,25 @@ bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_
 #endif
 }
 
+data_ptr_t LocalFileSystem::MapFile(FileHandle &handle, idx_t size) {
+	if (size == 0) {
+		return nullptr;
+	}
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	auto data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+	return data_ptr_cast(data);
+}
+
+void LocalFileSystem::UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) {
+	if (munmap(data, size) != 0) {
+		throw IOException("Could not unmap file \"%s\": %s", {{"errno", std::to_string(errno)}}, handle.path,
+		                  strerror(errno));
+	}
+}
+
 int64_t LocalFileSystem::GetFileSize(FileHandle &handle) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	struct stat s;
@@ -932,6 +971,15 @@ bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_
 	return false;
 }
 
+data_ptr_t LocalFileSystem::MapFile(FileHandle &handle, idx_t size) {
+	// memory mapping files is not supported on Windows: the block manager falls back to reading the blocks
+	return nullptr;
+}
+
+void LocalFileSystem::UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) {
+	throw NotImplementedException("UnmapFile is not implemented on Windows");
+}
+
 int64_t LocalFileSystem::GetFileSize(FileHandle &handle) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	LARGE_INTEGER result;
@@ -1094,6 +1142,239 @@ FileType LocalFileSystem::GetFileType(FileHandle &handle) {
 }
 #endif
 
+#ifdef DUCKDB_IO_URING
+//! A minimal io_uring instance that is used to have a batch of reads in flight at the same time
+class IOUringReader {
+public:
+	//! The maximum number of reads that are submitted at once
+	static constexpr unsigned RING_ENTRIES = 64;
+	//! The result of a read that was not submitted
+	static constexpr int64_t NOT_SUBMITTED = -1;
+
+	IOUringReader() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		auto result = syscall(__NR_io_uring_setup, RING_ENTRIES, &params);
+		if (result < 0) {
+			// io_uring is not supported (or not allowed)
+			return;
+		}
+		ring_fd = UnsafeNumericCast<int>(result);
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (single_mmap) {
+			sq_ring_size = MaxValue(sq_ring_size, cq_ring_size);
+			cq_ring_size = sq_ring_size;
+		}
+		sq_ring = Map(sq_ring_size, IORING_OFF_SQ_RING);
+		cq_ring = single_mmap ? sq_ring : Map(cq_ring_size, IORING_OFF_CQ_RING);
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = reinterpret_cast<io_uring_sqe *>(Map(sqes_size, IORING_OFF_SQES));
+		if (!sq_ring || !cq_ring || !sqes) {
+			Destroy();
+			return;
+		}
+		sq_head = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.head);
+		sq_tail = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.tail);
+		sq_mask = *reinterpret_cast<unsigned *>(sq_ring + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.array);
+		sq_entries = params.sq_entries;
+		cq_head = reinterpret_cast<unsigned *>(cq_ring + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(cq_ring + params.cq_off.tail);
+		cq_mask = *reinterpret_cast<unsigned *>(cq_ring + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+	}
+	~IOUringReader() {
+		Destroy();
+	}
+
+	bool IsAvailable() const {
+		return ring_fd >= 0;
+	}
+
+	idx_t MaxBatchSize() const {
+		return sq_entries;
+	}
+
+	//! Submits the reads [offset, offset + count) and waits for them to complete. The result of each read (the amount
+	//! of bytes that were read, or a negative value) is written to "results".
+	void Read(int fd, vector<FileReadRequest> &requests, idx_t offset, idx_t count, vector<int64_t> &results) {
+		D_ASSERT(count <= sq_entries);
+		auto tail = *sq_tail;
+		for (idx_t i = 0; i < count; i++) {
+			auto &request = requests[offset + i];
+			auto index = tail & sq_mask;
+			auto &sqe = sqes[index];
+			memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_READ;
+			sqe.fd = fd;
+			sqe.addr = reinterpret_cast<uint64_t>(request.buffer);
+			// reads larger than 4GB are completed by the fallback
+			sqe.len = UnsafeNumericCast<uint32_t>(MinValue<idx_t>(request.nr_bytes, NumericLimits<uint32_t>::Maximum()));
+			sqe.off = request.location;
+			sqe.user_data = offset + i;
+			sq_array[index] = index;
+			results[offset + i] = NOT_SUBMITTED;
+			tail++;
+		}
+		__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+		// submit the reads
+		idx_t submitted = 0;
+		while (submitted < count) {
+			auto result = syscall(__NR_io_uring_enter, ring_fd, count - submitted, 0, 0, nullptr, 0);
+			if (result < 0 && errno == EINTR) {
+				continue;
+			}
+			if (result <= 0) {
+				// the remaining reads could not be submitted: take them out of the ring again
+				__atomic_store_n(sq_tail, __atomic_load_n(sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+				break;
+			}
+			submitted += UnsafeNumericCast<idx_t>(result);
+		}
+		// wait for the submitted reads to complete
+		idx_t completed = 0;
+		int wait_error = 0;
+		while (completed < submitted) {
+			auto head = *cq_head;
+			auto cq_tail_value = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+			for (; head != cq_tail_value; head++) {
+				auto &cqe = cqes[head & cq_mask];
+				results[cqe.user_data] = cqe.res;
+				completed++;
+			}
+			__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+			if (completed >= submitted) {
+				break;
+			}
+			auto result = syscall(__NR_io_uring_enter, ring_fd, 0, submitted - completed, IORING_ENTER_GETEVENTS,
+			                      nullptr, 0);
+			if (result < 0 && errno != EINTR && wait_error == 0) {
+				// we cannot return while reads into the buffers might still be in flight: keep reaping completions
+				wait_error = errno;
+			}
+		}
+		if (wait_error != 0) {
+			throw IOException("Failed to wait for io_uring reads: %s", strerror(wait_error));
+		}
+	}
+
+private:
+	data_ptr_t Map(idx_t size, off_t offset) {
+		auto result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+		return result == MAP_FAILED ? nullptr : reinterpret_cast<data_ptr_t>(result);
+	}
+
+	void Destroy() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ring && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+		sqes = nullptr;
+		cq_ring = nullptr;
+		sq_ring = nullptr;
+		ring_fd = -1;
+	}
+
+private:
+	int ring_fd = -1;
+	data_ptr_t sq_ring = nullptr;
+	data_ptr_t cq_ring = nullptr;
+	io_uring_sqe *sqes = nullptr;
+	idx_t sq_ring_size = 0;
+	idx_t cq_ring_size = 0;
+	idx_t sqes_size = 0;
+	unsigned *sq_head = nullptr;
+	unsigned *sq_tail = nullptr;
+	unsigned *sq_array = nullptr;
+	unsigned sq_mask = 0;
+	unsigned sq_entries = 0;
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned cq_mask = 0;
+	io_uring_cqe *cqes = nullptr;
+};
+
+//! Setting up a ring is relatively expensive: rings are kept around to be reused by subsequent batches
+class IOUringReaderCache {
+public:
+	unique_ptr<IOUringReader> GetReader() {
+		if (unavailable) {
+			return nullptr;
+		}
+		{
+			lock_guard<mutex> guard(lock);
+			if (!readers.empty()) {
+				auto reader = std::move(readers.back());
+				readers.pop_back();
+				return reader;
+			}
+		}
+		auto reader = make_uniq<IOUringReader>();
+		if (!reader->IsAvailable()) {
+			unavailable = true;
+			return nullptr;
+		}
+		return reader;
+	}
+
+	void ReturnReader(unique_ptr<IOUringReader> reader) {
+		lock_guard<mutex> guard(lock);
+		readers.push_back(std::move(reader));
+	}
+
+private:
+	mutex lock;
+	vector<unique_ptr<IOUringReader>> readers;
+	atomic<bool> unavailable {false};
+};
+
+static IOUringReaderCache &GetIOUringReaderCache() {
+	static IOUringReaderCache cache;
+	return cache;
+}
+#endif
+
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+#ifdef DUCKDB_IO_URING
+	if (requests.size() > 1) {
+		auto &cache = GetIOUringReaderCache();
+		auto reader = cache.GetReader();
+		if (reader) {
+			int fd = handle.Cast<UnixFileHandle>().fd;
+			vector<int64_t> results(requests.size());
+			for (idx_t offset = 0; offset < requests.size(); offset += reader->MaxBatchSize()) {
+				auto count = MinValue<idx_t>(reader->MaxBatchSize(), requests.size() - offset);
+				reader->Read(fd, requests, offset, count, results);
+			}
+			cache.ReturnReader(std::move(reader));
+			// complete any reads that failed or that were short with regular reads, these also report the errors
+			for (idx_t i = 0; i < requests.size(); i++) {
+				auto &request = requests[i];
+				auto bytes_read = results[i] < 0 ? 0 : UnsafeNumericCast<idx_t>(results[i]);
+				if (bytes_read >= request.nr_bytes) {
+					continue;
+				}
+				Read(handle, static_cast<data_ptr_t>(request.buffer) + bytes_read,
+				     UnsafeNumericCast<int64_t>(request.nr_bytes - bytes_read), request.location + bytes_read);
+			}
+			return;
+		}
+	}
+#endif
+	FileSystem::ReadBatch(handle, requests);
+}
+
 bool LocalFileSystem::CanSeek() {
 	return true;
 }
@@ -142,6 +142,7 @@ vector<string> StringUtil::SplitWithQuote(const string &str, char delimiter, cha
 	while (i < str.size()) {
 		if (!entries.empty()) {
 			string_util_internal::ConsumeLetter(str, i, delimiter);
+			string_util_internal::SkipSpaces(str, i);
 		}
 
 		entries.emplace_back(string_util_internal::TakePossiblyQuotedItem(str, i, delimiter, quote));
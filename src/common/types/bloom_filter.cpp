@@ -0,0 +1,104 @@
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/prefetch.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+
+namespace duckdb {
+
+// the salts are used to derive one bit position per word of a block from the lower 32 bits of the hash
+static constexpr uint32_t BLOOM_FILTER_SALT[BloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+static inline uint32_t BloomFilterMask(uint32_t key, idx_t word_idx) {
+	return uint32_t(1) << ((key * BLOOM_FILTER_SALT[word_idx]) >> 27);
+}
+
+BloomFilter::BloomFilter(idx_t block_count_p) : block_count(MaxValue<idx_t>(block_count_p, 1)) {
+	data = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+	memset(data.get(), 0, SizeInBytes());
+}
+
+idx_t BloomFilter::BlockCount(idx_t key_count, idx_t bits_per_key) {
+	return MaxValue<idx_t>((key_count * bits_per_key + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK, 1);
+}
+
+void BloomFilter::Insert(hash_t hash) {
+	auto block = data.get() + GetBlockIndex(hash) * WORDS_PER_BLOCK;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= BloomFilterMask(key, i);
+	}
+}
+
+void BloomFilter::Insert(const hash_t *hashes, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		Insert(hashes[i]);
+	}
+}
+
+void BloomFilter::InsertParallel(const hash_t *hashes, idx_t count) {
+	auto words = reinterpret_cast<atomic<uint32_t> *>(data.get());
+	for (idx_t i = 0; i < count; i++) {
+		auto block = words + GetBlockIndex(hashes[i]) * WORDS_PER_BLOCK;
+		auto key = uint32_t(hashes[i]);
+		for (idx_t word_idx = 0; word_idx < WORDS_PER_BLOCK; word_idx++) {
+			auto mask = BloomFilterMask(key, word_idx);
+			// skip the atomic operation if the bit is already set
+			if ((block[word_idx].load(std::memory_order_relaxed) & mask) != mask) {
+				block[word_idx].fetch_or(mask, std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+bool BloomFilter::MayContain(hash_t hash) const {
+	auto block = data.get() + GetBlockIndex(hash) * WORDS_PER_BLOCK;
+	auto key = uint32_t(hash);
+	// no early exit: the checks of the words of the block are independent, so that the loop can be vectorized
+	uint32_t missing = 0;
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		auto mask = BloomFilterMask(key, i);
+		missing |= (block[i] & mask) ^ mask;
+	}
+	return missing == 0;
+}
+
+idx_t BloomFilter::MayContain(Vector &hashes, const SelectionVector &sel, idx_t count,
+                              SelectionVector &result_sel) const {
+	D_ASSERT(hashes.GetType() == LogicalType::HASH);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	if (SizeInBytes() >= PREFETCH_HASH_TABLE_THRESHOLD) {
+		// the filter does not fit in the caches: load the blocks of all hashes in flight before probing them
+		for (idx_t i = 0; i < count; i++) {
+			auto hash_idx = hdata.sel->get_index(sel.get_index(i));
+			DUCKDB_PREFETCH_READ(data.get() + GetBlockIndex(hash_data[hash_idx]) * WORDS_PER_BLOCK);
+		}
+	}
+
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = sel.get_index(i);
+		auto hash_idx = hdata.sel->get_index(row_idx);
+		result_sel.set_index(result_count, row_idx);
+		result_count += MayContain(hash_data[hash_idx]);
+	}
+	return result_count;
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<uint64_t>(100, "block_count", block_count);
+	serializer.WriteProperty(101, "data", const_data_ptr_cast(data.get()), SizeInBytes());
+}
+
+unique_ptr<BloomFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<uint64_t>(100, "block_count");
+	auto result = make_uniq<BloomFilter>(block_count);
+	deserializer.ReadProperty(101, "data", data_ptr_cast(result->data.get()), result->SizeInBytes());
+	return result;
+}
+
+} // namespace duckdb
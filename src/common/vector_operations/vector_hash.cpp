@@ -246,9 +246,53 @@ static inline void ArrayLoopHash(Vector &input, Vector &hashes, const SelectionV
 	}
 }
 
+//! Whether or not the input is a string dictionary vector with fewer dictionary entries than rows to hash
+static bool IsSmallStringDictionary(Vector &input, idx_t count) {
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR ||
+	    input.GetType().InternalType() != PhysicalType::VARCHAR) {
+		return false;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	return dictionary_size.IsValid() && dictionary_size.GetIndex() < count;
+}
+
+//! Hashes every entry of the dictionary once, and then looks up the hash of every row
+template <bool HAS_RSEL, bool FIRST_HASH>
+static void DictionaryLoopHash(Vector &input, Vector &hashes, const SelectionVector *rsel, idx_t count) {
+	auto &dictionary = DictionaryVector::Child(input);
+	auto dictionary_size = DictionaryVector::DictionarySize(input).GetIndex();
+	Vector dictionary_hashes(LogicalType::HASH, dictionary_size);
+	VectorOperations::Hash(dictionary, dictionary_hashes, dictionary_size);
+	dictionary_hashes.Flatten(dictionary_size);
+	auto dictionary_hash_data = FlatVector::GetData<hash_t>(dictionary_hashes);
+
+	auto &sel = DictionaryVector::SelVector(input);
+	if (FIRST_HASH || hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		hash_t constant_hash = FIRST_HASH ? 0 : *ConstantVector::GetData<hash_t>(hashes);
+		hashes.SetVectorType(VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			auto other_hash = dictionary_hash_data[sel.get_index(ridx)];
+			hash_data[ridx] = FIRST_HASH ? other_hash : CombineHashScalar(constant_hash, other_hash);
+		}
+	} else {
+		D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(hash_data[ridx], dictionary_hash_data[sel.get_index(ridx)]);
+		}
+	}
+}
+
 template <bool HAS_RSEL>
 static inline void HashTypeSwitch(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
 	D_ASSERT(result.GetType().id() == LogicalType::HASH);
+	if (IsSmallStringDictionary(input, count)) {
+		DictionaryLoopHash<HAS_RSEL, true>(input, result, rsel, count);
+		return;
+	}
 	switch (input.GetType().InternalType()) {
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
@@ -388,6 +432,10 @@ void TemplatedLoopCombineHash(Vector &input, Vector &hashes, const SelectionVect
 template <bool HAS_RSEL>
 static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const SelectionVector *rsel, idx_t count) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	if (IsSmallStringDictionary(input, count)) {
+		DictionaryLoopHash<HAS_RSEL, false>(input, hashes, rsel, count);
+		return;
+	}
 	switch (input.GetType().InternalType()) {
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
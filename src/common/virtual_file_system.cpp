@@ -50,6 +50,18 @@ void VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes,
 	handle.file_system.Read(handle, buffer, nr_bytes, location);
 }
 
+void VirtualFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	handle.file_system.ReadBatch(handle, requests);
+}
+
+data_ptr_t VirtualFileSystem::MapFile(FileHandle &handle, idx_t size) {
+	return handle.file_system.MapFile(handle, size);
+}
+
+void VirtualFileSystem::UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) {
+	handle.file_system.UnmapFile(handle, data, size);
+}
+
 void VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	handle.file_system.Write(handle, buffer, nr_bytes, location);
 }
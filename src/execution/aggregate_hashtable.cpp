@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/null_value.hpp"
@@ -329,11 +330,16 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	// and precompute the hash salts for faster comparison below
 	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
 	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
+	const auto prefetch = capacity * sizeof(aggr_ht_entry_t) >= PREFETCH_HASH_TABLE_THRESHOLD;
 	for (idx_t r = 0; r < groups.size(); r++) {
 		const auto &hash = hashes[r];
 		ht_offsets[r] = ApplyBitMask(hash);
 		D_ASSERT(ht_offsets[r] == hash % capacity);
 		hash_salts[r] = aggr_ht_entry_t::ExtractSalt(hash);
+		if (prefetch) {
+			// the entries of the whole vector are loaded in flight before they are probed below
+			DUCKDB_PREFETCH_WRITE(entries + ht_offsets[r]);
+		}
 	}
 
 	// we start out with all entries [0, 1, 2, ..., groups.size()]
@@ -422,6 +428,10 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 				const auto index = state.group_compare_vector.get_index(need_compare_idx);
 				const auto &entry = entries[ht_offsets[index]];
 				addresses[index] = entry.GetPointer();
+				if (prefetch) {
+					// the rows are loaded in flight before the RowMatcher compares them
+					DUCKDB_PREFETCH_READ(addresses[index]);
+				}
 			}
 
 			// Perform group comparisons
@@ -1,12 +1,15 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
+#include <cmath>
+
 namespace duckdb {
 
 using ValidityBytes = JoinHashTable::ValidityBytes;
@@ -18,7 +21,9 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), prefetch_probes(false), bloom_filter_built(false), use_bloom_filter(false),
+      bloom_filter_decided(false), bloom_filter_probe_count(0), bloom_filter_non_empty_count(0),
+      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -112,6 +117,10 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
 		result_data[rindex] = main_ht + (hash & bitmask);
+		if (prefetch_probes) {
+			// the buckets of the whole vector are loaded in flight, before InitializeSelectionVector reads them
+			DUCKDB_PREFETCH_READ(result_data[rindex]);
+		}
 	}
 }
 
@@ -304,6 +313,19 @@ void JoinHashTable::InitializePointerTable() {
 	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
 
 	bitmask = capacity - 1;
+	prefetch_probes = capacity * sizeof(data_ptr_t) >= PREFETCH_HASH_TABLE_THRESHOLD;
+
+	// the bloom filter is filled alongside the pointer table, whether it is used is decided while probing
+	if (Count() >= BLOOM_FILTER_MIN_COUNT) {
+		bloom_filter = make_uniq<BloomFilter>(BloomFilter::BlockCount(Count(), BLOOM_FILTER_BITS_PER_KEY));
+	} else {
+		bloom_filter.reset();
+	}
+	bloom_filter_built = bloom_filter != nullptr;
+	use_bloom_filter = false;
+	bloom_filter_decided = !bloom_filter;
+	bloom_filter_probe_count = 0;
+	bloom_filter_non_empty_count = 0;
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -321,6 +343,13 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			if (parallel) {
+				bloom_filter->InsertParallel(hash_data, count);
+			} else {
+				bloom_filter->Insert(hash_data, count);
+			}
+		}
 		InsertHashes(hashes, count, row_locations, parallel);
 	} while (iterator.Next());
 }
@@ -353,20 +382,60 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		ProbeHashes(*ss, *precomputed_hashes, current_sel);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
+		ProbeHashes(*ss, hashes, current_sel);
+	}
+	return ss;
+}
 
-		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+void JoinHashTable::ProbeHashes(ScanStructure &ss, Vector &hashes, const SelectionVector *current_sel) {
+	if (use_bloom_filter) {
+		// skip the keys that are certainly not in the HT before touching the (much larger) pointer table
+		ss.count = bloom_filter->MayContain(hashes, *current_sel, ss.count, ss.sel_vector);
+		current_sel = &ss.sel_vector;
+		if (ss.count == 0) {
+			return;
+		}
 	}
 
+	// now initialize the pointers of the scan structure based on the hashes
+	ApplyBitmask(hashes, *current_sel, ss.count, ss.pointers);
+
 	// create the selection vector linking to only non-empty entries
-	ss->InitializeSelectionVector(current_sel);
+	const auto probe_count = ss.count;
+	ss.InitializeSelectionVector(current_sel);
 
-	return ss;
+	if (!bloom_filter_decided) {
+		UpdateBloomFilterStatistics(probe_count, ss.count);
+	}
+}
+
+void JoinHashTable::UpdateBloomFilterStatistics(idx_t probe_count, idx_t non_empty_count) {
+	bloom_filter_non_empty_count += non_empty_count;
+	if ((bloom_filter_probe_count += probe_count) < BLOOM_FILTER_SAMPLE_SIZE) {
+		return;
+	}
+	lock_guard<mutex> guard(bloom_filter_lock);
+	if (bloom_filter_decided) {
+		return;
+	}
+	// a key without a match still ends up in a non-empty bucket with the probability that a bucket is occupied
+	// we use this to estimate the fraction of probed keys that have a match from the fraction of non-empty buckets
+	const auto load_factor = double(Count()) / double(bitmask + 1);
+	const auto occupied = 1.0 - std::exp(-load_factor);
+	const auto non_empty = double(bloom_filter_non_empty_count) / double(bloom_filter_probe_count);
+	const auto hit_rate = (non_empty - occupied) / (1.0 - occupied);
+	if (hit_rate < BLOOM_FILTER_MAX_HIT_RATE) {
+		use_bloom_filter = true;
+	} else {
+		// most keys have a match: the bloom filter would not filter out anything
+		bloom_filter.reset();
+	}
+	bloom_filter_decided = true;
 }
 
 ScanStructure::ScanStructure(JoinHashTable &ht_p, TupleDataChunkState &key_state_p)
@@ -456,6 +525,9 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, idx_t sel_count)
 		auto idx = sel.get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx] + ht.pointer_offset);
 		if (ptrs[idx]) {
+			if (ht.prefetch_probes) {
+				DUCKDB_PREFETCH_READ(ptrs[idx]);
+			}
 			this->sel_vector.set_index(new_count++, idx);
 		}
 	}
@@ -470,6 +542,10 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 		const auto idx = current_sel->get_index(i);
 		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
+			if (ht.prefetch_probes) {
+				// the rows of the whole vector are loaded in flight, before the RowMatcher compares them
+				DUCKDB_PREFETCH_READ(ptrs[idx]);
+			}
 			sel_vector.set_index(non_empty_count++, idx);
 		}
 	}
@@ -1054,13 +1130,19 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 		return ss;
 	}
 
-	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	ProbeHashes(*ss, hashes, current_sel);
+	return ss;
+}
 
-	// create the selection vector linking to only non-empty entries
-	ss->InitializeSelectionVector(current_sel);
+void JoinHashTable::Spill(DataChunk &keys, DataChunk &payload, ProbeSpill &probe_spill,
+                          ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk) {
+	Vector hashes(LogicalType::HASH);
+	Hash(keys, *FlatVector::IncrementalSelectionVector(), keys.size(), hashes);
 
-	return ss;
+	CreateSpillChunk(spill_chunk, keys, payload, hashes);
+	spill_chunk.SetCardinality(keys.size());
+	spill_chunk.Verify();
+	probe_spill.Append(spill_chunk, spill_state);
 }
 
 ProbeSpill::ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types)
@@ -1102,15 +1184,31 @@ void ProbeSpill::Finalize() {
 }
 
 void ProbeSpill::PrepareNextProbe() {
+	PrepareScan(ht.partition_start, ht.partition_end);
+}
+
+void ProbeSpill::PrepareFullScan() {
+	PrepareScan(0, global_partitions->GetPartitions().size());
+}
+
+idx_t ProbeSpill::Count() const {
+	idx_t count = 0;
+	for (auto &partition : global_partitions->GetPartitions()) {
+		count += partition->Count();
+	}
+	return count;
+}
+
+void ProbeSpill::PrepareScan(idx_t partition_start, idx_t partition_end) {
 	auto &partitions = global_partitions->GetPartitions();
-	if (partitions.empty() || ht.partition_start == partitions.size()) {
+	if (partitions.empty() || partition_start == partitions.size()) {
 		// Can't probe, just make an empty one
 		global_spill_collection =
 		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
 	} else {
 		// Move specific partitions to the global spill collection
-		global_spill_collection = std::move(partitions[ht.partition_start]);
-		for (idx_t i = ht.partition_start + 1; i < ht.partition_end; i++) {
+		global_spill_collection = std::move(partitions[partition_start]);
+		for (idx_t i = partition_start + 1; i < partition_end; i++) {
 			auto &partition = partitions[i];
 			if (global_spill_collection->Count() == 0) {
 				global_spill_collection = std::move(partition);
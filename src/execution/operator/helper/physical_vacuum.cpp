@@ -93,6 +93,10 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
+	if (info->options.vacuum) {
+		// compact the deleted rows of the table during the next checkpoint
+		tbl->GetStorage().RequestCompaction();
+	}
 
 	return SinkFinalizeType::READY;
 }
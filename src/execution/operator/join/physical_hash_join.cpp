@@ -13,7 +13,10 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -91,7 +94,7 @@ public:
 	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_update_count(0),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
-	      scanned_data(false) {
+	      partitioned_in_memory(false), deferred_build(false), scanned_data(false), bloom_filter_reported(false) {
 		hash_table = op.InitializeHashTable(context);
 
 		// for perfect hash join
@@ -103,10 +106,19 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+		// the filters of a previous execution of this join are no longer valid
+		if (op.filter_pushdown) {
+			op.filter_pushdown->dynamic_filters->ClearFilters(op);
+			for (auto &column : op.filter_pushdown->columns) {
+				key_statistics.push_back(BaseStatistics::CreateEmpty(op.condition_types[column.condition_idx]));
+			}
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! The maximum size of the HT that is built for a round of the external join
+	idx_t MaxPartitionedHTSize() const;
 
 public:
 	ClientContext &context;
@@ -125,6 +137,12 @@ public:
 
 	//! Whether we are doing an external join
 	bool external;
+	//! Whether the HT fits in memory, but is built and probed in cache-sized partitions, one round at a time, in the
+	//! same way as the external join
+	bool partitioned_in_memory;
+	//! Whether building the HT is deferred until the probe side is materialized, so that the build and probe side can
+	//! be swapped if the build side turns out to be much larger than the probe side
+	bool deferred_build;
 
 	//! Hash tables built by each thread
 	mutex lock;
@@ -136,6 +154,11 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+	//! Whether the decision on using the bloom filter of the HT was added to the profiler
+	atomic<bool> bloom_filter_reported;
+
+	//! The min/max of the join keys that are pushed into the probe side
+	vector<BaseStatistics> key_statistics;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +178,12 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			for (auto &column : op.filter_pushdown->columns) {
+				key_statistics.push_back(BaseStatistics::CreateEmpty(op.condition_types[column.condition_idx]));
+			}
+		}
 	}
 
 public:
@@ -167,6 +196,8 @@ public:
 
 	//! Thread-local HT
 	unique_ptr<JoinHashTable> hash_table;
+	//! The min/max of the join keys that are pushed into the probe side
+	vector<BaseStatistics> key_statistics;
 
 	//! For updating the temporary memory state
 	idx_t chunk_count;
@@ -232,6 +263,61 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 	return make_uniq<HashJoinLocalSinkState>(*this, context.client);
 }
 
+template <class T>
+static void TemplatedUpdateKeyStatistics(Vector &keys, idx_t count, BaseStatistics &stats) {
+	UnifiedVectorFormat format;
+	keys.ToUnifiedFormat(count, format);
+	auto data = UnifiedVectorFormat::GetData<T>(format);
+
+	bool has_value = false;
+	T min_value = T();
+	T max_value = T();
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = format.sel->get_index(i);
+		if (!format.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (!has_value) {
+			min_value = data[idx];
+			max_value = data[idx];
+			has_value = true;
+		} else {
+			NumericStats::UpdateValue<T>(data[idx], min_value, max_value);
+		}
+	}
+	if (has_value) {
+		NumericStats::Update<T>(stats, min_value);
+		NumericStats::Update<T>(stats, max_value);
+	}
+}
+
+static void UpdateKeyStatistics(Vector &keys, idx_t count, BaseStatistics &stats) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedUpdateKeyStatistics<int8_t>(keys, count, stats);
+	case PhysicalType::INT16:
+		return TemplatedUpdateKeyStatistics<int16_t>(keys, count, stats);
+	case PhysicalType::INT32:
+		return TemplatedUpdateKeyStatistics<int32_t>(keys, count, stats);
+	case PhysicalType::INT64:
+		return TemplatedUpdateKeyStatistics<int64_t>(keys, count, stats);
+	case PhysicalType::INT128:
+		return TemplatedUpdateKeyStatistics<hugeint_t>(keys, count, stats);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateKeyStatistics<uint8_t>(keys, count, stats);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateKeyStatistics<uint16_t>(keys, count, stats);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateKeyStatistics<uint32_t>(keys, count, stats);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateKeyStatistics<uint64_t>(keys, count, stats);
+	case PhysicalType::UINT128:
+		return TemplatedUpdateKeyStatistics<uhugeint_t>(keys, count, stats);
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
@@ -239,6 +325,14 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	// keep track of the range of the keys that are pushed into the probe side
+	if (filter_pushdown) {
+		for (idx_t i = 0; i < filter_pushdown->columns.size(); i++) {
+			auto &keys = lstate.join_keys.data[filter_pushdown->columns[i].condition_idx];
+			UpdateKeyStatistics(keys, lstate.join_keys.size(), lstate.key_statistics[i]);
+		}
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -274,6 +368,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
+		for (idx_t i = 0; i < lstate.key_statistics.size(); i++) {
+			gstate.key_statistics[i].Merge(lstate.key_statistics[i]);
+		}
 	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
@@ -363,6 +460,14 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 	event.InsertEvent(std::move(new_event));
 }
 
+idx_t HashJoinGlobalSinkState::MaxPartitionedHTSize() const {
+	const auto reservation = temporary_memory_state->GetReservation();
+	if (partitioned_in_memory) {
+		return MinValue<idx_t>(reservation, JoinHashTable::PARTITIONED_IN_MEMORY_HT_SIZE);
+	}
+	return reservation;
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	lock_guard<mutex> guard(lock);
 	if (!probe_spill) {
@@ -450,30 +555,124 @@ public:
 		sink.hash_table->GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
 		sink.temporary_memory_state->SetMinimumReservation(max_partition_size +
 		                                                   JoinHashTable::PointerTableSize(max_partition_count));
-		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+		if (sink.deferred_build) {
+			// The HT is built once the probe side is materialized
+			return;
+		}
+		sink.hash_table->PrepareExternalFinalize(sink.MaxPartitionedHTSize());
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
 };
 
+void PhysicalHashJoin::PushDynamicFilters(const vector<BaseStatistics> &key_statistics) const {
+	D_ASSERT(filter_pushdown);
+	auto &dynamic_filters = *filter_pushdown->dynamic_filters;
+	for (idx_t i = 0; i < filter_pushdown->columns.size(); i++) {
+		auto &stats = key_statistics[i];
+		auto column_index = filter_pushdown->columns[i].probe_column_index;
+		auto min_value = NumericStats::Min(stats);
+		auto max_value = NumericStats::Max(stats);
+		if (min_value > max_value) {
+			// there are no (non-NULL) keys: nothing on the probe side can match
+			dynamic_filters.PushFilter(*this, column_index, make_uniq<IsNullFilter>());
+			dynamic_filters.PushFilter(*this, column_index, make_uniq<IsNotNullFilter>());
+		} else if (min_value == max_value) {
+			dynamic_filters.PushFilter(*this, column_index,
+			                           make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_value)));
+		} else {
+			dynamic_filters.PushFilter(
+			    *this, column_index,
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_value)));
+			dynamic_filters.PushFilter(
+			    *this, column_index,
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_value)));
+		}
+	}
+}
+
+//! Whether a join whose HT fits in memory should be built and probed in cache-sized radix partitions. This pays off
+//! when the HT is far too large to be cache-resident, and the probe side is expected to be at least as large as the
+//! build side, as partitioning the probe side is only cheaper than the cache misses it saves if there are many probes
+static bool UsePartitionedInMemoryJoin(const PhysicalHashJoin &op, HashJoinGlobalSinkState &sink, idx_t total_size,
+                                       idx_t build_count) {
+	if (sink.perfect_join_executor->CanDoPerfectHashJoin()) {
+		return false;
+	}
+	if (total_size <= JoinHashTable::PARTITIONED_IN_MEMORY_HT_SIZE ||
+	    total_size < ClientConfig::GetConfig(sink.context).partitioned_hash_join_threshold) {
+		return false;
+	}
+	return op.children[0]->estimated_cardinality >= build_count;
+}
+
+//! Whether the actual cardinality differs from the estimated cardinality by at least the role reversal factor
+static bool IsMisestimate(idx_t estimated_count, idx_t actual_count) {
+	auto larger = double(MaxValue<idx_t>(estimated_count, actual_count));
+	auto smaller = double(MaxValue<idx_t>(MinValue<idx_t>(estimated_count, actual_count), 1));
+	return larger >= smaller * double(PhysicalHashJoin::ROLE_REVERSAL_FACTOR);
+}
+
+//! Whether the build side is so much larger than the probe side is estimated to be, that building the HT should be
+//! deferred until the probe side is materialized, and its actual size is known. If the estimate was right, the build
+//! and probe side are swapped. Only inner joins on equalities are symmetric enough to do this
+static bool DeferBuildForRoleReversal(const PhysicalHashJoin &op, HashJoinGlobalSinkState &sink, idx_t build_count) {
+	if (!ClientConfig::GetConfig(sink.context).enable_join_role_reversal || op.join_type != JoinType::INNER) {
+		return false;
+	}
+	for (auto &condition : op.conditions) {
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+	}
+	if (sink.perfect_join_executor->CanDoPerfectHashJoin() || build_count < PhysicalHashJoin::ROLE_REVERSAL_MIN_COUNT) {
+		return false;
+	}
+	return double(build_count) >
+	       double(op.children[0]->estimated_cardinality) * double(PhysicalHashJoin::ROLE_REVERSAL_FACTOR);
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (filter_pushdown) {
+		PushDynamicFilters(sink.key_statistics);
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
 	sink.temporary_memory_state->SetRemainingSize(context, total_size);
 
+	idx_t build_count = 0;
+	for (auto &local_ht : sink.local_hash_tables) {
+		build_count += local_ht->GetSinkCollection().Count();
+	}
+	if (IsMisestimate(children[1]->estimated_cardinality, build_count)) {
+		QueryProfiler::Get(context).AppendOperatorInfo(
+		    *this, StringUtil::Format("Build Side Misestimate: %llu Estimated, %llu Actual",
+		                              children[1]->estimated_cardinality, build_count));
+	}
+
 	sink.external = sink.temporary_memory_state->GetReservation() < total_size;
+	if (DeferBuildForRoleReversal(*this, sink, build_count)) {
+		// The probe side is materialized (like in an external join) before we decide which side to build the HT on
+		sink.external = true;
+		sink.deferred_build = true;
+	} else if (!sink.external && UsePartitionedInMemoryJoin(*this, sink, total_size, build_count)) {
+		// The HT fits in memory, but it is built and probed in cache-sized partitions
+		sink.external = true;
+		sink.partitioned_in_memory = true;
+	}
 	if (sink.external) {
 		const auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
 		// External Hash Join
 		sink.perfect_join_executor.reset();
-		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation()) {
+		if (max_partition_ht_size > sink.MaxPartitionedHTSize()) {
 			// We have to repartition
-			ht.SetRepartitionRadixBits(sink.local_hash_tables, sink.temporary_memory_state->GetReservation(),
-			                           max_partition_size, max_partition_count);
+			ht.SetRepartitionRadixBits(sink.local_hash_tables, sink.MaxPartitionedHTSize(), max_partition_size,
+			                           max_partition_count);
 			auto new_event = make_shared_ptr<HashJoinRepartitionEvent>(pipeline, sink, sink.local_hash_tables);
 			event.InsertEvent(std::move(new_event));
 		} else {
@@ -483,8 +682,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 				ht.Merge(*local_ht);
 			}
 			sink.local_hash_tables.clear();
-			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
-			sink.ScheduleFinalize(pipeline, event);
+			if (!sink.deferred_build) {
+				sink.hash_table->PrepareExternalFinalize(sink.MaxPartitionedHTSize());
+				sink.ScheduleFinalize(pipeline, event);
+			}
 		}
 		sink.finalized = true;
 		return SinkFinalizeType::READY;
@@ -539,6 +740,21 @@ public:
 public:
 	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
 		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+		ReportBloomFilter(op, context.client);
+	}
+
+private:
+	//! Adds whether the bloom filter of the HT is probed to the profiler, once this was decided by one of the threads
+	static void ReportBloomFilter(const PhysicalOperator &op, ClientContext &context) {
+		auto &sink = op.sink_state->Cast<HashJoinGlobalSinkState>();
+		if (!sink.hash_table || !sink.hash_table->BuiltBloomFilter() || !sink.hash_table->BloomFilterDecided()) {
+			return;
+		}
+		if (sink.bloom_filter_reported.exchange(true)) {
+			return;
+		}
+		QueryProfiler::Get(context).AppendOperatorInfo(
+		    op, sink.hash_table->UsesBloomFilter() ? "Bloom Filter: Used" : "Bloom Filter: Not Used");
 	}
 };
 
@@ -579,6 +795,14 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 		state.initialized = true;
 	}
 
+	if (sink.deferred_build) {
+		// The HT is not built yet: spill everything, it is joined once we know which side to build the HT on
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		sink.hash_table->Spill(state.join_keys, input, *sink.probe_spill, state.spill_state, state.spill_chunk);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
 	if (sink.hash_table->Count() == 0 && EmptyResultIfRHSIsEmpty()) {
 		return OperatorResultType::FINISHED;
 	}
@@ -622,7 +846,7 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-enum class HashJoinSourceStage : uint8_t { INIT, BUILD, PROBE, SCAN_HT, DONE };
+enum class HashJoinSourceStage : uint8_t { INIT, BUILD, PROBE, SCAN_HT, REVERSED_PROBE, DONE };
 
 class HashJoinLocalSourceState;
 
@@ -638,6 +862,8 @@ public:
 	void PrepareBuild(HashJoinGlobalSinkState &sink);
 	void PrepareProbe(HashJoinGlobalSinkState &sink);
 	void PrepareScanHT(HashJoinGlobalSinkState &sink);
+	//! Build a HT on the materialized probe side, and prepare probing it with the build side (must hold lock)
+	void PrepareReversedProbe(HashJoinGlobalSinkState &sink, idx_t build_count, idx_t probe_count);
 	//! Assigns a task to a local source state
 	bool AssignTask(HashJoinGlobalSinkState &sink, HashJoinLocalSourceState &lstate);
 
@@ -646,7 +872,10 @@ public:
 		auto &gstate = op.sink_state->Cast<HashJoinGlobalSinkState>();
 
 		idx_t count;
-		if (gstate.probe_spill) {
+		if (gstate.deferred_build) {
+			// If the build and probe side are swapped, the (much larger) build side is scanned
+			count = gstate.hash_table->GetSinkCollection().Count();
+		} else if (gstate.probe_spill) {
 			count = probe_count;
 		} else if (PropagatesBuildSide(op.join_type)) {
 			count = gstate.hash_table->Count();
@@ -683,6 +912,16 @@ public:
 	atomic<idx_t> full_outer_chunk_done;
 	idx_t full_outer_chunks_per_thread;
 
+	//! For a join of which the build and probe side are swapped: the HT that is built on the probe side
+	vector<JoinCondition> reversed_conditions;
+	vector<idx_t> reversed_output_columns;
+	unique_ptr<JoinHashTable> reversed_hash_table;
+	//! For a join of which the build and probe side are swapped: the scan of the build side that probes the HT
+	TupleDataParallelScanState reversed_scan_state;
+	idx_t reversed_chunk_idx;
+	idx_t reversed_chunk_count;
+	atomic<idx_t> reversed_chunk_done;
+
 	vector<InterruptState> blocked_tasks;
 };
 
@@ -698,6 +937,8 @@ public:
 	void ExternalBuild(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate);
 	void ExternalProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
 	void ExternalScanHT(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
+	//! Probe the HT of the probe side with the build side, if the build and probe side are swapped
+	void ReversedProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
 
 public:
 	//! The stage that this thread was assigned work for
@@ -727,6 +968,13 @@ public:
 	idx_t full_outer_chunk_idx_from;
 	idx_t full_outer_chunk_idx_to;
 	unique_ptr<JoinHTScanState> full_outer_scan_state;
+
+	//! Local scan state and chunks for probing the HT of the probe side with the build side
+	TupleDataLocalScanState reversed_scan_state;
+	DataChunk reversed_build_chunk;
+	DataChunk reversed_join_keys;
+	DataChunk reversed_payload;
+	DataChunk reversed_result;
 };
 
 unique_ptr<GlobalSourceState> PhysicalHashJoin::GetGlobalSourceState(ClientContext &context) const {
@@ -741,7 +989,8 @@ unique_ptr<LocalSourceState> PhysicalHashJoin::GetLocalSourceState(ExecutionCont
 HashJoinGlobalSourceState::HashJoinGlobalSourceState(const PhysicalHashJoin &op, ClientContext &context)
     : op(op), global_stage(HashJoinSourceStage::INIT), build_chunk_count(0), build_chunk_done(0), probe_chunk_count(0),
       probe_chunk_done(0), probe_count(op.children[0]->estimated_cardinality),
-      parallel_scan_chunk_count(context.config.verify_parallelism ? 1 : 120) {
+      parallel_scan_chunk_count(context.config.verify_parallelism ? 1 : 120), reversed_chunk_idx(0),
+      reversed_chunk_count(0), reversed_chunk_done(0) {
 }
 
 void HashJoinGlobalSourceState::Initialize(HashJoinGlobalSinkState &sink) {
@@ -756,6 +1005,16 @@ void HashJoinGlobalSourceState::Initialize(HashJoinGlobalSinkState &sink) {
 		sink.probe_spill->Finalize();
 	}
 
+	if (sink.deferred_build) {
+		// Now that the probe side is materialized, we know whether it is much smaller than the build side
+		const auto build_count = sink.hash_table->GetSinkCollection().Count();
+		const auto probe_count = sink.probe_spill ? sink.probe_spill->Count() : 0;
+		if (double(build_count) > double(probe_count) * double(PhysicalHashJoin::ROLE_REVERSAL_FACTOR)) {
+			PrepareReversedProbe(sink, build_count, probe_count);
+			return;
+		}
+	}
+
 	global_stage = HashJoinSourceStage::PROBE;
 	TryPrepareNextStage(sink);
 }
@@ -786,6 +1045,13 @@ bool HashJoinGlobalSourceState::TryPrepareNextStage(HashJoinGlobalSinkState &sin
 			return true;
 		}
 		break;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		if (reversed_chunk_done == reversed_chunk_count) {
+			global_stage = HashJoinSourceStage::DONE;
+			sink.temporary_memory_state->SetRemainingSize(sink.context, 0);
+			return true;
+		}
+		break;
 	default:
 		break;
 	}
@@ -800,7 +1066,7 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	sink.temporary_memory_state->SetRemainingSize(sink.context, ht.GetRemainingSize());
 
 	// Try to put the next partitions in the block collection of the HT
-	if (!sink.external || !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation())) {
+	if (!sink.external || !ht.PrepareExternalFinalize(sink.MaxPartitionedHTSize())) {
 		global_stage = HashJoinSourceStage::DONE;
 		sink.temporary_memory_state->SetRemainingSize(sink.context, 0);
 		return;
@@ -853,6 +1119,91 @@ void HashJoinGlobalSourceState::PrepareScanHT(HashJoinGlobalSinkState &sink) {
 	global_stage = HashJoinSourceStage::SCAN_HT;
 }
 
+void HashJoinGlobalSourceState::PrepareReversedProbe(HashJoinGlobalSinkState &sink, idx_t build_count,
+                                                     idx_t probe_count) {
+	auto &context = sink.context;
+	QueryProfiler::Get(context).AppendOperatorInfo(
+	    op, StringUtil::Format("Build And Probe Side Swapped: %llu Build Tuples, %llu Probe Tuples", build_count,
+	                           probe_count));
+	if (probe_count == 0) {
+		global_stage = HashJoinSourceStage::DONE;
+		sink.temporary_memory_state->SetRemainingSize(context, 0);
+		return;
+	}
+
+	// The keys of the materialized probe side precede its payload, so the conditions of the HT reference them directly
+	const auto &probe_types = op.children[0]->types;
+	vector<idx_t> join_key_indices;
+	vector<idx_t> payload_indices;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		JoinCondition condition;
+		condition.left = make_uniq<BoundReferenceExpression>(op.condition_types[cond_idx], cond_idx);
+		condition.right = make_uniq<BoundReferenceExpression>(op.condition_types[cond_idx], cond_idx);
+		condition.comparison = op.conditions[cond_idx].comparison;
+		reversed_conditions.push_back(std::move(condition));
+		join_key_indices.push_back(cond_idx);
+	}
+	for (idx_t col_idx = 0; col_idx < probe_types.size(); col_idx++) {
+		reversed_output_columns.push_back(op.conditions.size() + col_idx);
+		payload_indices.push_back(op.conditions.size() + col_idx);
+	}
+	reversed_hash_table = make_uniq<JoinHashTable>(BufferManager::GetBufferManager(context), reversed_conditions,
+	                                               probe_types, JoinType::INNER, reversed_output_columns);
+	auto &reversed_ht = *reversed_hash_table;
+
+	// Build the HT on the probe side, which is small, so this is done by a single thread
+	PartitionedTupleDataAppendState append_state;
+	reversed_ht.GetSinkCollection().InitializeAppendState(append_state);
+	DataChunk probe_chunk;
+	DataChunk join_keys;
+	DataChunk payload;
+	probe_chunk.Initialize(BufferAllocator::Get(context), sink.probe_types);
+	join_keys.InitializeEmpty(op.condition_types);
+	payload.InitializeEmpty(probe_types);
+
+	sink.probe_spill->PrepareFullScan();
+	auto &consumer = *sink.probe_spill->consumer;
+	ColumnDataConsumerScanState probe_scan_state;
+	probe_scan_state.current_chunk_state.properties = ColumnDataScanProperties::ALLOW_ZERO_COPY;
+	while (consumer.AssignChunk(probe_scan_state)) {
+		consumer.ScanChunk(probe_scan_state, probe_chunk);
+		join_keys.ReferenceColumns(probe_chunk, join_key_indices);
+		payload.ReferenceColumns(probe_chunk, payload_indices);
+		reversed_ht.Build(append_state, join_keys, payload);
+		consumer.FinishChunk(probe_scan_state);
+	}
+	reversed_ht.GetSinkCollection().FlushAppendState(append_state);
+	reversed_ht.Unpartition();
+	if (reversed_ht.Count() == 0) {
+		// All probe side keys are NULL
+		global_stage = HashJoinSourceStage::DONE;
+		sink.temporary_memory_state->SetRemainingSize(context, 0);
+		return;
+	}
+	reversed_ht.InitializePointerTable();
+	reversed_ht.Finalize(0, reversed_ht.GetDataCollection().ChunkCount(), false);
+	reversed_ht.finalized = true;
+
+	// The build side is scanned in parallel, and probes the HT with its keys
+	auto &ht = *sink.hash_table;
+	ht.Unpartition();
+	auto &data_collection = ht.GetDataCollection();
+	vector<column_t> column_ids;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		column_ids.push_back(cond_idx);
+	}
+	for (auto &output_column : op.rhs_output_columns) {
+		column_ids.push_back(output_column);
+	}
+	data_collection.InitializeScan(reversed_scan_state, std::move(column_ids));
+
+	reversed_chunk_idx = 0;
+	reversed_chunk_count = data_collection.ChunkCount();
+	reversed_chunk_done = 0;
+
+	global_stage = HashJoinSourceStage::REVERSED_PROBE;
+}
+
 bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJoinLocalSourceState &lstate) {
 	D_ASSERT(lstate.TaskFinished());
 
@@ -884,6 +1235,14 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 			return true;
 		}
 		break;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		if (reversed_chunk_idx != reversed_chunk_count) {
+			// Every task probes with one chunk of the build side
+			lstate.local_stage = global_stage;
+			reversed_chunk_idx++;
+			return true;
+		}
+		break;
 	case HashJoinSourceStage::DONE:
 		break;
 	default:
@@ -925,6 +1284,9 @@ void HashJoinLocalSourceState::ExecuteTask(HashJoinGlobalSinkState &sink, HashJo
 	case HashJoinSourceStage::SCAN_HT:
 		ExternalScanHT(sink, gstate, chunk);
 		break;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		ReversedProbe(sink, gstate, chunk);
+		break;
 	default:
 		throw InternalException("Unexpected HashJoinSourceStage in ExecuteTask!");
 	}
@@ -939,6 +1301,8 @@ bool HashJoinLocalSourceState::TaskFinished() {
 		return scan_structure == nullptr && !empty_ht_probe_in_progress;
 	case HashJoinSourceStage::SCAN_HT:
 		return full_outer_scan_state == nullptr;
+	case HashJoinSourceStage::REVERSED_PROBE:
+		return scan_structure == nullptr;
 	default:
 		throw InternalException("Unexpected HashJoinSourceStage in TaskFinished!");
 	}
@@ -1012,6 +1376,72 @@ void HashJoinLocalSourceState::ExternalScanHT(HashJoinGlobalSinkState &sink, Has
 	}
 }
 
+//! The result of probing the HT of the probe side has the build side columns first, the join outputs them last
+static void ReferenceReversedResult(DataChunk &reversed_result, idx_t build_column_count, DataChunk &chunk) {
+	const auto probe_column_count = reversed_result.ColumnCount() - build_column_count;
+	for (idx_t col_idx = 0; col_idx < probe_column_count; col_idx++) {
+		chunk.data[col_idx].Reference(reversed_result.data[build_column_count + col_idx]);
+	}
+	for (idx_t col_idx = 0; col_idx < build_column_count; col_idx++) {
+		chunk.data[probe_column_count + col_idx].Reference(reversed_result.data[col_idx]);
+	}
+	chunk.SetCardinality(reversed_result);
+}
+
+void HashJoinLocalSourceState::ReversedProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
+                                             DataChunk &chunk) {
+	D_ASSERT(local_stage == HashJoinSourceStage::REVERSED_PROBE && gstate.reversed_hash_table);
+	auto &op = gstate.op;
+
+	if (scan_structure) {
+		// Still have elements remaining (i.e. we got >STANDARD_VECTOR_SIZE elements in the previous probe)
+		reversed_result.Reset();
+		scan_structure->Next(reversed_join_keys, reversed_payload, reversed_result);
+		if (reversed_result.size() != 0 || !scan_structure->PointersExhausted()) {
+			ReferenceReversedResult(reversed_result, op.rhs_output_types.size(), chunk);
+			return;
+		}
+
+		// Previous probe is done
+		scan_structure = nullptr;
+		gstate.reversed_chunk_done++;
+		return;
+	}
+
+	auto &data_collection = sink.hash_table->GetDataCollection();
+	if (reversed_result.ColumnCount() == 0) {
+		auto column_ids = gstate.reversed_scan_state.scan_state.chunk_state.column_ids;
+		data_collection.InitializeScan(reversed_scan_state, std::move(column_ids));
+		auto &allocator = BufferAllocator::Get(sink.context);
+		vector<LogicalType> build_types(op.condition_types);
+		build_types.insert(build_types.end(), op.rhs_output_types.begin(), op.rhs_output_types.end());
+		reversed_build_chunk.Initialize(allocator, build_types);
+		reversed_join_keys.InitializeEmpty(op.condition_types);
+		reversed_payload.InitializeEmpty(op.rhs_output_types);
+		vector<LogicalType> result_types(op.rhs_output_types);
+		result_types.insert(result_types.end(), op.children[0]->types.begin(), op.children[0]->types.end());
+		reversed_result.Initialize(allocator, result_types);
+	}
+
+	// Scan the next chunk of the build side, and probe the HT of the probe side with it
+	data_collection.Scan(gstate.reversed_scan_state, reversed_scan_state, reversed_build_chunk);
+	D_ASSERT(reversed_build_chunk.size() != 0);
+	const auto key_count = reversed_join_keys.ColumnCount();
+	for (idx_t col_idx = 0; col_idx < key_count; col_idx++) {
+		reversed_join_keys.data[col_idx].Reference(reversed_build_chunk.data[col_idx]);
+	}
+	reversed_join_keys.SetCardinality(reversed_build_chunk);
+	for (idx_t col_idx = 0; col_idx < reversed_payload.ColumnCount(); col_idx++) {
+		reversed_payload.data[col_idx].Reference(reversed_build_chunk.data[key_count + col_idx]);
+	}
+	reversed_payload.SetCardinality(reversed_build_chunk);
+
+	reversed_result.Reset();
+	scan_structure = gstate.reversed_hash_table->Probe(reversed_join_keys, join_key_state);
+	scan_structure->Next(reversed_join_keys, reversed_payload, reversed_result);
+	ReferenceReversedResult(reversed_result, op.rhs_output_types.size(), chunk);
+}
+
 SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSourceInput &input) const {
 	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
@@ -1065,6 +1495,10 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 		return 100.0;
 	}
 
+	if (gstate.global_stage == HashJoinSourceStage::REVERSED_PROBE) {
+		return double(gstate.reversed_chunk_done) / double(gstate.reversed_chunk_count) * 100.0;
+	}
+
 	double num_partitions = RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits());
 	double partition_start = sink.hash_table->GetPartitionStart();
 	double partition_end = sink.hash_table->GetPartitionEnd();
@@ -4,6 +4,7 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
@@ -129,6 +130,124 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+static bool JoinFilterPushdownTypeSupported(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::ENUM:
+	case LogicalTypeId::TIME_TZ:
+		return false;
+	default:
+		break;
+	}
+	auto physical_type = type.InternalType();
+	return TypeIsInteger(physical_type);
+}
+
+//! Follows the column of a join key down the probe side of a hash join, through the operators that are in the same
+//! pipeline, to the table scan that produces it. Returns nullptr if the column is not a column of a table scan.
+static optional_ptr<PhysicalTableScan> FindProbeSideScan(PhysicalOperator &probe, idx_t column_index,
+                                                         idx_t &scan_column_index) {
+	reference<PhysicalOperator> current(probe);
+	while (true) {
+		auto &op = current.get();
+		switch (op.type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &expr = *op.Cast<PhysicalProjection>().select_list[column_index];
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return nullptr;
+			}
+			column_index = expr.Cast<BoundReferenceExpression>().index;
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			break;
+		case PhysicalOperatorType::HASH_JOIN: {
+			// the columns of the probe side come first, and every probe side row is either emitted or discarded
+			switch (op.Cast<PhysicalHashJoin>().join_type) {
+			case JoinType::INNER:
+			case JoinType::LEFT:
+			case JoinType::SEMI:
+			case JoinType::ANTI:
+			case JoinType::MARK:
+				break;
+			default:
+				return nullptr;
+			}
+			if (column_index >= op.children[0]->types.size()) {
+				return nullptr;
+			}
+			break;
+		}
+		case PhysicalOperatorType::TABLE_SCAN: {
+			auto &scan = op.Cast<PhysicalTableScan>();
+			if (!scan.function.filter_pushdown) {
+				return nullptr;
+			}
+			if (!scan.projection_ids.empty()) {
+				column_index = scan.projection_ids[column_index];
+			}
+			if (scan.column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+				return nullptr;
+			}
+			scan_column_index = column_index;
+			return &scan;
+		}
+		default:
+			return nullptr;
+		}
+		current = *op.children[0];
+	}
+}
+
+//! Sets up the hash join to push the range of its build side keys into the table scan on its probe side
+static void PlanJoinFilterPushdown(ClientContext &context, PhysicalHashJoin &join) {
+	if (!ClientConfig::GetConfig(context).enable_join_filter_pushdown) {
+		return;
+	}
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		// probe side rows without a match are discarded
+		break;
+	default:
+		return;
+	}
+	optional_ptr<PhysicalTableScan> probe_scan;
+	vector<JoinFilterPushdownColumn> columns;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &condition = join.conditions[cond_idx];
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (condition.left->type != ExpressionType::BOUND_REF ||
+		    !JoinFilterPushdownTypeSupported(condition.left->return_type)) {
+			continue;
+		}
+		idx_t scan_column_index;
+		auto scan = FindProbeSideScan(*join.children[0], condition.left->Cast<BoundReferenceExpression>().index,
+		                              scan_column_index);
+		if (!scan || (probe_scan && probe_scan.get() != scan.get())) {
+			continue;
+		}
+		if (scan->returned_types[scan->column_ids[scan_column_index]] != condition.left->return_type) {
+			continue;
+		}
+		probe_scan = scan;
+		columns.push_back(JoinFilterPushdownColumn {cond_idx, scan_column_index});
+	}
+	if (columns.empty()) {
+		return;
+	}
+	if (!probe_scan->dynamic_filters) {
+		probe_scan->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	}
+	join.filter_pushdown = make_uniq<JoinFilterPushdownInfo>();
+	join.filter_pushdown->dynamic_filters = probe_scan->dynamic_filters;
+	join.filter_pushdown->columns = std::move(columns);
+}
+
 bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &range_count) {
 	for (size_t c = 0; c < conds.size(); ++c) {
 		auto &cond = conds[c];
@@ -193,9 +312,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+			PlanJoinFilterPushdown(context, *hash_join);
+		}
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
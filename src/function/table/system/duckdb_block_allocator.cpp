@@ -0,0 +1,106 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+
+namespace duckdb {
+
+struct DuckDBBlockAllocatorData : public GlobalTableFunctionState {
+	DuckDBBlockAllocatorData() : finished(false) {
+	}
+
+	BlockAllocatorInformation information;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBBlockAllocatorBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("enabled");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("huge_pages");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("block_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("region_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reserved_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("used_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("free_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("allocations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("recycled_allocations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("fallback_allocations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_rate");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBBlockAllocatorInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBBlockAllocatorData>();
+
+	auto &buffer_pool = DatabaseInstance::GetDatabase(context).GetBufferPool();
+	result->information = buffer_pool.GetBlockAllocator().GetInformation();
+	return std::move(result);
+}
+
+void DuckDBBlockAllocatorFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBBlockAllocatorData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &entry = data.information;
+	// return values:
+	idx_t col = 0;
+	// enabled, BOOLEAN
+	output.SetValue(col++, 0, Value::BOOLEAN(entry.enabled));
+	// huge_pages, BOOLEAN
+	output.SetValue(col++, 0, Value::BOOLEAN(entry.huge_pages));
+	// block_size, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.block_size)));
+	// region_count, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.region_count)));
+	// reserved_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.reserved_memory)));
+	// used_blocks, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.used_blocks)));
+	// free_blocks, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.free_blocks)));
+	// allocations, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.allocations)));
+	// recycled_allocations, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.recycled_allocations)));
+	// fallback_allocations, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.fallback_allocations)));
+	// hit_rate, DOUBLE: the fraction of the allocations that recycled a freed block
+	auto total_allocations = entry.allocations + entry.fallback_allocations;
+	output.SetValue(col++, 0,
+	                total_allocations == 0
+	                    ? Value(LogicalType::DOUBLE)
+	                    : Value::DOUBLE(static_cast<double>(entry.recycled_allocations) /
+	                                    static_cast<double>(total_allocations)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBBlockAllocatorFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_block_allocator", {}, DuckDBBlockAllocatorFunction,
+	                              DuckDBBlockAllocatorBind, DuckDBBlockAllocatorInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,108 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+
+namespace duckdb {
+
+struct DuckDBBufferPoolData : public GlobalTableFunctionState {
+	DuckDBBufferPoolData() : finished(false) {
+	}
+
+	idx_t memory_limit;
+	idx_t memory_usage;
+	BufferPoolEvictionStatistics statistics;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBBufferPoolBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("memory_limit_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("background_eviction");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("high_watermark_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("low_watermark_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reservations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("inline_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("inline_evicted_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("background_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("background_evicted_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+//! Returns the size as a BIGINT, or NULL if there is no memory limit
+static Value GetSizeValue(idx_t size) {
+	if (size > static_cast<idx_t>(NumericLimits<int64_t>::Maximum())) {
+		return Value(LogicalType::BIGINT);
+	}
+	return Value::BIGINT(NumericCast<int64_t>(size));
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBBufferPoolInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBBufferPoolData>();
+
+	auto &buffer_pool = DatabaseInstance::GetDatabase(context).GetBufferPool();
+	result->memory_limit = buffer_pool.GetMaxMemory();
+	result->memory_usage = buffer_pool.GetUsedMemory();
+	result->statistics = buffer_pool.GetEvictionStatistics();
+	return std::move(result);
+}
+
+void DuckDBBufferPoolFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBBufferPoolData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &entry = data.statistics;
+	// return values:
+	idx_t col = 0;
+	// memory_limit_bytes, BIGINT
+	output.SetValue(col++, 0, GetSizeValue(data.memory_limit));
+	// memory_usage_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(data.memory_usage)));
+	// background_eviction, BOOLEAN
+	output.SetValue(col++, 0, Value::BOOLEAN(entry.background_eviction));
+	// high_watermark_bytes, BIGINT
+	output.SetValue(col++, 0, GetSizeValue(entry.high_watermark));
+	// low_watermark_bytes, BIGINT
+	output.SetValue(col++, 0, GetSizeValue(entry.low_watermark));
+	// reservations, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.reservations)));
+	// inline_evictions, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.inline_evictions)));
+	// inline_evicted_blocks, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.inline_evicted_blocks)));
+	// background_evictions, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.background_evictions)));
+	// background_evicted_blocks, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(entry.background_evicted_blocks)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBBufferPoolFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_buffer_pool", {}, DuckDBBufferPoolFunction, DuckDBBufferPoolBind, DuckDBBufferPoolInit));
+}
+
+} // namespace duckdb
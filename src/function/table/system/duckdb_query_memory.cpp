@@ -0,0 +1,82 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryMemoryData : public GlobalTableFunctionState {
+	DuckDBQueryMemoryData() : offset(0) {
+	}
+
+	vector<QueryMemoryInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryMemoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("memory_limit_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reservation_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("remaining_size_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("operator_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("admitted");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryMemoryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryMemoryData>();
+
+	result->entries = TemporaryMemoryManager::Get(context).GetQueryInformation();
+	return std::move(result);
+}
+
+void DuckDBQueryMemoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryMemoryData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// query, VARCHAR
+		output.SetValue(col++, count, Value(entry.query));
+		// memory_limit_bytes, BIGINT
+		output.SetValue(col++, count,
+		                entry.memory_limit == DConstants::INVALID_INDEX
+		                    ? Value(LogicalType::BIGINT)
+		                    : Value::BIGINT(NumericCast<int64_t>(entry.memory_limit)));
+		// reservation_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.reservation)));
+		// remaining_size_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.remaining_size)));
+		// operator_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.state_count)));
+		// admitted, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(entry.admitted));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryMemoryFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_memory", {}, DuckDBQueryMemoryFunction, DuckDBQueryMemoryBind,
+	                              DuckDBQueryMemoryInit));
+}
+
+} // namespace duckdb
@@ -18,6 +18,8 @@
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/query_profiler.hpp"
 
 namespace duckdb {
 
@@ -74,6 +76,7 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		col = storage_idx;
 	}
 	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	result->scan_state.options.read_ahead_depth = DBConfig::GetConfig(context.client).options.scan_read_ahead_depth;
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
 		auto &tsgs = gstate->Cast<TableScanGlobalState>();
@@ -116,6 +119,21 @@ static unique_ptr<BaseStatistics> TableScanStatistics(ClientContext &context, co
 	return bind_data.table.GetStatistics(context, column_id);
 }
 
+static void TableScanFlushStatistics(ClientContext &context, TableScanLocalState &state) {
+	auto &table_state = state.scan_state.table_state;
+	if (table_state.pruned_row_groups > 0) {
+		QueryProfiler::Get(context).AddPrunedRowGroups(table_state.pruned_row_groups);
+		table_state.pruned_row_groups = 0;
+	}
+	auto &read_ahead = table_state.read_ahead;
+	if (!read_ahead) {
+		return;
+	}
+	QueryProfiler::Get(context).AddReadAheadStatistics(read_ahead->hits.load(), read_ahead->misses);
+	read_ahead->hits = 0;
+	read_ahead->misses = 0;
+}
+
 static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &gstate = data_p.global_state->Cast<TableScanGlobalState>();
@@ -140,6 +158,7 @@ static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, Da
 		}
 		if (!TableScanParallelStateNext(context, data_p.bind_data.get(), data_p.local_state.get(),
 		                                data_p.global_state.get())) {
+			TableScanFlushStatistics(context, state);
 			return;
 		}
 	} while (true);
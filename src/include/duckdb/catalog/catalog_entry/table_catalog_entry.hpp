@@ -78,6 +78,8 @@ public:
 
 	//! Returns a list of the constraints of the table
 	DUCKDB_API const vector<unique_ptr<Constraint>> &GetConstraints() const;
+	//! Returns the columns the table is kept sorted on when it is checkpointed (empty if the table has no sort key)
+	DUCKDB_API const vector<string> &GetSortKey() const;
 	DUCKDB_API string ToSQL() const override;
 
 	//! Get statistics of a column (physical or virtual) within the table
@@ -112,5 +114,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The columns the table is kept sorted on when it is checkpointed (if any)
+	vector<string> sort_key;
 };
 } // namespace duckdb
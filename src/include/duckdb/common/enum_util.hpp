@@ -114,6 +114,12 @@ enum class DistinctType : uint8_t;
 
 enum class ErrorType : uint16_t;
 
+enum class EvictionPolicyType : uint8_t;
+
+enum class EvictionPriority : uint8_t;
+
+enum class EvictionSegment : uint8_t;
+
 enum class ExceptionFormatValueType : uint8_t;
 
 enum class ExceptionType : uint8_t;
@@ -298,6 +304,8 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TemporaryFileCompression : uint8_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionType : uint8_t;
@@ -450,6 +458,15 @@ const char* EnumUtil::ToChars<DistinctType>(DistinctType value);
 template<>
 const char* EnumUtil::ToChars<ErrorType>(ErrorType value);
 
+template<>
+const char* EnumUtil::ToChars<EvictionPolicyType>(EvictionPolicyType value);
+
+template<>
+const char* EnumUtil::ToChars<EvictionPriority>(EvictionPriority value);
+
+template<>
+const char* EnumUtil::ToChars<EvictionSegment>(EvictionSegment value);
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value);
 
@@ -726,6 +743,9 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TemporaryFileCompression>(TemporaryFileCompression value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -892,6 +912,15 @@ DistinctType EnumUtil::FromString<DistinctType>(const char *value);
 template<>
 ErrorType EnumUtil::FromString<ErrorType>(const char *value);
 
+template<>
+EvictionPolicyType EnumUtil::FromString<EvictionPolicyType>(const char *value);
+
+template<>
+EvictionPriority EnumUtil::FromString<EvictionPriority>(const char *value);
+
+template<>
+EvictionSegment EnumUtil::FromString<EvictionSegment>(const char *value);
+
 template<>
 ExceptionFormatValueType EnumUtil::FromString<ExceptionFormatValueType>(const char *value);
 
@@ -1168,6 +1197,9 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TemporaryFileCompression EnumUtil::FromString<TemporaryFileCompression>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -51,6 +51,17 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A single read of a batch of reads (see FileSystem::ReadBatch)
+struct FileReadRequest {
+	FileReadRequest(void *buffer, idx_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	void *buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -61,6 +72,7 @@ public:
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void ReadBatch(vector<FileReadRequest> &requests);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
@@ -116,6 +128,9 @@ public:
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Perform a batch of reads with a location, each of which fails if its nr_bytes could not be read. File systems
+	//! can override this to have the reads in flight concurrently, by default they are performed one-by-one.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests);
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
@@ -124,6 +139,11 @@ public:
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
 	//! this range (sparse file support). Reads to the range will succeed but will return undefined data.
 	DUCKDB_API virtual bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes);
+	//! Map the first "size" bytes of the file into memory as read-only, the mapping is valid until UnmapFile is called.
+	//! Returns nullptr if the file could not be mapped. This is not a required method, by default files are not mapped.
+	DUCKDB_API virtual data_ptr_t MapFile(FileHandle &handle, idx_t size);
+	//! Unmap a mapping of the file that was returned by MapFile
+	DUCKDB_API virtual void UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size);
 
 	//! Returns the file size of a file handle, returns -1 on error
 	DUCKDB_API virtual int64_t GetFileSize(FileHandle &handle);
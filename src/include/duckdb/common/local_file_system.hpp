@@ -24,6 +24,9 @@ public:
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	//! Perform a batch of reads with a location. On Linux the reads are submitted to an io_uring (when available), so
+	//! that they are all in flight at the same time.
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override;
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
@@ -33,6 +36,9 @@ public:
 	//! range (sparse file support). Reads to the range will succeed but will return
 	//! undefined data.
 	bool Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) override;
+	//! Map the file into memory as read-only, this is currently not supported on Windows
+	data_ptr_t MapFile(FileHandle &handle, idx_t size) override;
+	void UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) override;
 
 	//! Returns the file size of a file handle, returns -1 on error
 	int64_t GetFileSize(FileHandle &handle) override;
@@ -38,6 +38,18 @@ public:
 		GetFileSystem().Write(handle, buffer, nr_bytes, location);
 	}
 
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override {
+		GetFileSystem().ReadBatch(handle, requests);
+	}
+
+	data_ptr_t MapFile(FileHandle &handle, idx_t size) override {
+		return GetFileSystem().MapFile(handle, size);
+	}
+
+	void UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) override {
+		GetFileSystem().UnmapFile(handle, data, size);
+	}
+
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return GetFileSystem().Read(handle, buffer, nr_bytes);
 	}
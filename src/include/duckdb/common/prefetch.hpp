@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+#if __GNUC__
+#define DUCKDB_PREFETCH_READ(address)  (__builtin_prefetch((address), 0, 3))
+#define DUCKDB_PREFETCH_WRITE(address) (__builtin_prefetch((address), 1, 3))
+#else
+#define DUCKDB_PREFETCH_READ(address)  ((void)(address))
+#define DUCKDB_PREFETCH_WRITE(address) ((void)(address))
+#endif
+
+namespace duckdb {
+
+//! Hash tables that are smaller than this are expected to stay in the CPU caches, so probes into them are not prefetched
+static constexpr const idx_t PREFETCH_HASH_TABLE_THRESHOLD = 1048576;
+
+} // namespace duckdb
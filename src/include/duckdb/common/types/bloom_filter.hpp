@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+
+//! The BloomFilter class holds a split block bloom filter for approximate set membership tests
+//! Every key sets exactly one bit in each of the words of a single block, so that inserting or probing a key only
+//! touches a single cache line
+class BloomFilter {
+public:
+	//! The number of 32-bit words in a block
+	static constexpr idx_t WORDS_PER_BLOCK = 8;
+	//! The size of a block in bits
+	static constexpr idx_t BITS_PER_BLOCK = WORDS_PER_BLOCK * sizeof(uint32_t) * 8;
+
+public:
+	explicit BloomFilter(idx_t block_count);
+	// implicit copying of BloomFilter is not allowed
+	BloomFilter(const BloomFilter &) = delete;
+
+	//! Returns the number of blocks required to store "key_count" distinct keys using "bits_per_key" bits each
+	static idx_t BlockCount(idx_t key_count, idx_t bits_per_key);
+
+	//! Insert a hash into the filter
+	void Insert(hash_t hash);
+	//! Insert "count" hashes into the filter
+	void Insert(const hash_t *hashes, idx_t count);
+	//! Insert "count" hashes into the filter, while other threads may be inserting into the filter concurrently
+	void InsertParallel(const hash_t *hashes, idx_t count);
+	//! Returns false if the hash is definitely not in the filter, true if it might be
+	bool MayContain(hash_t hash) const;
+	//! Probe "count" hashes (of type HASH) from the "sel" selection, writes the rows that might be contained in the
+	//! filter to "result_sel" and returns how many there are
+	idx_t MayContain(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result_sel) const;
+
+	//! The number of blocks in the filter
+	idx_t BlockCount() const {
+		return block_count;
+	}
+	//! The size of the filter in bytes
+	idx_t SizeInBytes() const {
+		return block_count * WORDS_PER_BLOCK * sizeof(uint32_t);
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<BloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		// multiply-shift instead of modulo, the upper bits of the hash select the block
+		return idx_t((uint64_t(hash >> 32) * uint64_t(block_count)) >> 32);
+	}
+
+	idx_t block_count;
+	unsafe_unique_array<uint32_t> data;
+};
+
+} // namespace duckdb
@@ -24,6 +24,9 @@ public:
 
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override;
+	data_ptr_t MapFile(FileHandle &handle, idx_t size) override;
+	void UnmapFile(FileHandle &handle, data_ptr_t data, idx_t size) override;
 
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
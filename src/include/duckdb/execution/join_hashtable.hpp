@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/null_value.hpp"
@@ -190,6 +192,9 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Whether the HT is too large to be cache-resident, in which case the buckets and rows of a vector of probed keys
+	//! are prefetched before they are accessed
+	bool prefetch_probes;
 
 	struct {
 		mutex mj_lock;
@@ -216,6 +221,11 @@ private:
 	//! Apply a bitmask to the hashes
 	void ApplyBitmask(Vector &hashes, idx_t count);
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Look up the hashes of the keys in the pointer table, initializing the pointers of the scan structure
+	void ProbeHashes(ScanStructure &ss, Vector &hashes, const SelectionVector *current_sel);
+	//! Keep track of the fraction of probed keys that ended up in a non-empty bucket, and decide whether to use the
+	//! bloom filter once enough keys were probed
+	void UpdateBloomFilterStatistics(idx_t probe_count, idx_t non_empty_count);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -235,6 +245,20 @@ private:
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
 
+	//! The bloom filter over the hashes of the build side keys, built alongside the pointer table of large HTs
+	unique_ptr<BloomFilter> bloom_filter;
+	//! Whether the bloom filter was built, it is destroyed again if it is not used
+	bool bloom_filter_built;
+	//! Whether the bloom filter is probed before the pointer table, i.e., whether it was observed that few of the
+	//! probed keys have a match
+	atomic<bool> use_bloom_filter;
+	//! Whether it was decided whether or not the bloom filter is used
+	atomic<bool> bloom_filter_decided;
+	//! The amount of probed keys, and the amount of those keys that ended up in a non-empty bucket
+	atomic<idx_t> bloom_filter_probe_count;
+	atomic<idx_t> bloom_filter_non_empty_count;
+	mutex bloom_filter_lock;
+
 	//! Copying not allowed
 	JoinHashTable(const JoinHashTable &) = delete;
 
@@ -243,6 +267,9 @@ public:
 	// External Join
 	//===--------------------------------------------------------------------===//
 	static constexpr const idx_t INITIAL_RADIX_BITS = 4;
+	//! The target size of the HT of a round of a join that is built and probed in cache-sized partitions while it fits
+	//! in memory. The HT of a round is shared by all threads, so this targets the last-level cache
+	static constexpr const idx_t PARTITIONED_IN_MEMORY_HT_SIZE = 4ULL * 1024ULL * 1024ULL;
 
 	struct ProbeSpillLocalAppendState {
 		//! Local partition and append state (if partitioned)
@@ -267,9 +294,17 @@ public:
 	public:
 		//! Prepare the next probe round
 		void PrepareNextProbe();
+		//! Prepare a scan of all partitions, e.g., to build a HT on the probe side
+		void PrepareFullScan();
+		//! The amount of probe tuples in the (finalized) partitions
+		idx_t Count() const;
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
+	private:
+		//! Moves the partitions in the range [partition_start, partition_end) to the active probe data
+		void PrepareScan(idx_t partition_start, idx_t partition_end);
+
 	private:
 		JoinHashTable &ht;
 		mutex lock;
@@ -301,6 +336,29 @@ public:
 		return partition_end;
 	}
 
+	//! The minimum amount of keys for which the bloom filter is built, i.e., the bloom filter is only built if the
+	//! pointer table is too large to be cache-resident
+	static constexpr const idx_t BLOOM_FILTER_MIN_COUNT = 65536;
+	//! The amount of bits per key of the bloom filter
+	static constexpr const idx_t BLOOM_FILTER_BITS_PER_KEY = 8;
+	//! The amount of probed keys that is observed before deciding whether to use the bloom filter
+	static constexpr const idx_t BLOOM_FILTER_SAMPLE_SIZE = 16 * STANDARD_VECTOR_SIZE;
+	//! The bloom filter is used if the estimated fraction of probed keys that have a match is below this threshold
+	static constexpr const double BLOOM_FILTER_MAX_HIT_RATE = 0.25;
+
+	//! Whether a bloom filter was built alongside the pointer table
+	bool BuiltBloomFilter() const {
+		return bloom_filter_built;
+	}
+	//! Whether it was decided whether the bloom filter is used, which happens once enough keys were probed
+	bool BloomFilterDecided() const {
+		return bloom_filter_decided;
+	}
+	//! Whether the bloom filter is probed before the pointer table
+	bool UsesBloomFilter() const {
+		return use_bloom_filter;
+	}
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -332,6 +390,9 @@ public:
 	unique_ptr<ScanStructure> ProbeAndSpill(DataChunk &keys, TupleDataChunkState &key_state, DataChunk &payload,
 	                                        ProbeSpill &probe_spill, ProbeSpillLocalAppendState &spill_state,
 	                                        DataChunk &spill_chunk);
+	//! Sink all of the keys into the probe spill without probing, e.g., because the HT is not built yet
+	void Spill(DataChunk &keys, DataChunk &payload, ProbeSpill &probe_spill, ProbeSpillLocalAppendState &spill_state,
+	           DataChunk &spill_chunk);
 
 private:
 	//! The current number of radix bits used to partition
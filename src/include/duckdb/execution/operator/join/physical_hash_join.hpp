@@ -14,9 +14,27 @@
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/operator/logical_join.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
+//! A join key of which the range is pushed into the table scan on the probe side of the hash join
+struct JoinFilterPushdownColumn {
+	//! The index of the join condition
+	idx_t condition_idx;
+	//! The index of the key column in the column ids of the probe side table scan
+	idx_t probe_column_index;
+};
+
+//! Once the hash table is built, the min/max of the build side keys are pushed into the table scan on the probe side,
+//! so that the scan can skip row groups and segments that cannot produce any matches
+struct JoinFilterPushdownInfo {
+	//! The dynamic filters of the probe side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The join keys of which the range is pushed
+	vector<JoinFilterPushdownColumn> columns;
+};
+
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
@@ -33,6 +51,8 @@ public:
 
 	//! Initialize HT for this operator
 	unique_ptr<JoinHashTable> InitializeHashTable(ClientContext &context) const;
+	//! Push the range of the build side keys into the probe side
+	void PushDynamicFilters(const vector<BaseStatistics> &key_statistics) const;
 
 	//! The types of the join keys
 	vector<LogicalType> condition_types;
@@ -51,6 +71,13 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The join keys of which the range is pushed into the probe side (if any)
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
+
+	//! The build and probe side are swapped at runtime if the build side is larger than the probe side by this factor
+	static constexpr const idx_t ROLE_REVERSAL_FACTOR = 16;
+	//! The minimum amount of build side tuples for which the build and probe side are swapped, smaller HTs are cheap
+	static constexpr const idx_t ROLE_REVERSAL_MIN_COUNT = 65536;
 
 public:
 	string ParamsToString() const override;
@@ -23,6 +23,8 @@ class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
 struct ColumnSegmentState;
+class TableFilter;
+class SelectionVector;
 
 struct ColumnFetchState;
 struct ColumnScanState;
@@ -142,6 +144,12 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for scanning an entire vector while evaluating a filter directly on the compressed data.
+//! Rows in 'sel' that can not satisfy the filter are removed from 'sel' (updating 'approved_tuple_count'); their
+//! values in 'result' do not need to be written. Rows that remain are not guaranteed to satisfy the filter.
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                     Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                     const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -178,13 +186,13 @@ public:
 	                    compression_revert_append_t revert_append = nullptr,
 	                    compression_serialize_state_t serialize_state = nullptr,
 	                    compression_deserialize_state_t deserialize_state = nullptr,
-	                    compression_cleanup_state_t cleanup_state = nullptr)
+	                    compression_cleanup_state_t cleanup_state = nullptr, compression_filter_t filter = nullptr)
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial), fetch_row(fetch_row), skip(skip),
 	      init_segment(init_segment), init_append(init_append), append(append), finalize_append(finalize_append),
 	      revert_append(revert_append), serialize_state(serialize_state), deserialize_state(deserialize_state),
-	      cleanup_state(cleanup_state) {
+	      cleanup_state(cleanup_state), filter(filter) {
 	}
 
 	//! Compression type
@@ -250,6 +258,10 @@ public:
 	compression_deserialize_state_t deserialize_state;
 	//! Cleanup the segment state (optional)
 	compression_cleanup_state_t cleanup_state;
+
+	// Filter functions
+	//! Scan an entire vector and prune rows that can not match a filter on the compressed representation (optional)
+	compression_filter_t filter;
 };
 
 //! The set of compression functions
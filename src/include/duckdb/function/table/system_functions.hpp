@@ -89,6 +89,18 @@ struct DuckDBMemoryFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBBlockAllocatorFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBBufferPoolFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBQueryMemoryFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBOptimizersFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
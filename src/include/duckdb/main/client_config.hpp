@@ -81,6 +81,10 @@ struct ClientConfig {
 	bool force_fetch_row = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Whether hash joins push the range of their build side keys into the table scans of their probe side
+	bool enable_join_filter_pushdown = true;
+	//! Whether hash joins swap their build and probe side at runtime if the build side turns out to be much larger
+	bool enable_join_role_reversal = true;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
@@ -89,6 +93,9 @@ struct ClientConfig {
 	idx_t perfect_ht_threshold = 12;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
+	//! The minimum size of the HT of an in-memory hash join for which the join is radix-partitioned into cache-sized
+	//! partitions that are built and probed one at a time
+	idx_t partitioned_hash_join_threshold = idx_t(128) * 1024 * 1024;
 	//! The number of rows to accumulate before flushing during a partitioned write
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 
@@ -110,6 +117,9 @@ struct ClientConfig {
 	//! Output error messages as structured JSON instead of as a raw string
 	bool errors_as_json = false;
 
+	//! The memory budget of the queries of this connection, overrides the global budget (INVALID_INDEX: not set)
+	idx_t query_memory_limit = DConstants::INVALID_INDEX;
+
 	//! Generic options
 	case_insensitive_map_t<Value> set_variables;
 
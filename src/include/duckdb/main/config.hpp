@@ -29,6 +29,7 @@
 #include "duckdb/parser/parser_extension.hpp"
 #include "duckdb/planner/operator_extension.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
+#include "duckdb/storage/buffer/eviction_policy.hpp"
 #include "duckdb/main/client_properties.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 
@@ -56,6 +57,8 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+enum class TemporaryFileCompression : uint8_t { NONE = 0, ZSTD = 1 };
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -98,8 +101,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
-	//! Whether or not to use Direct IO, bypassing operating system buffers
+	//! Whether or not to use Direct IO for database files and temporary files, bypassing operating system buffers. The
+	//! buffers that are read from and written to these files are then aligned to the sector size.
 	bool use_direct_io = false;
+	//! Whether or not database files that are attached read-only are memory mapped, instead of reading their blocks
+	//! into the buffer pool
+	bool mmap_read_only = false;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
 #ifdef DUCKDB_EXTENSION_AUTOLOAD_DEFAULT
@@ -122,20 +129,37 @@ struct DBConfigOptions {
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
+	//! The memory budget of each query for its operators, queries wait until their budget is available (in bytes).
+	//! Default: no budget.
+	idx_t query_memory_limit = DConstants::INVALID_INDEX;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = DConstants::INVALID_INDEX;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! Whether to pin the threads to the NUMA nodes and keep tasks on the node they were scheduled on. Default: false.
+	bool numa_aware_scheduling = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! How to compress the buffers that are written to the temporary directory
+	TemporaryFileCompression temp_file_compression = TemporaryFileCompression::NONE;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! The policy that decides which blocks the buffer manager evicts first
+	EvictionPolicyType eviction_policy = EvictionPolicyType::LRU;
+	//! Whether the blocks of the buffer pool are allocated from the slab allocator that is backed by huge pages
+	bool slab_allocator = false;
+	//! Whether a background thread evicts blocks ahead of time, so that queries rarely have to evict blocks themselves
+	bool background_eviction = false;
+	//! The fraction of the memory limit above which the background thread starts evicting blocks
+	double background_eviction_high_watermark = 0.9;
+	//! The fraction of the memory limit that the background thread evicts blocks down to
+	double background_eviction_low_watermark = 0.8;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
@@ -183,6 +207,10 @@ struct DBConfigOptions {
 	bool allow_extensions_metadata_mismatch = false;
 	//! Enable emitting FSST Vectors
 	bool enable_fsst_vectors = false;
+	//! Whether or not to build bloom filters for the columns of row groups during checkpointing
+	bool enable_row_group_bloom_filters = false;
+	//! The number of row groups that table scans load in the background ahead of the row group they are scanning
+	idx_t scan_read_ahead_depth = 0;
 	//! Start transactions immediately in all attached databases - instead of lazily when a database is referenced
 	bool immediate_transaction_mode = false;
 	//! Debug setting - how to initialize  blocks in the storage layer when allocating
@@ -105,6 +105,13 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Adds the number of blocks that the read-ahead of a table scan did and did not load in time
+	DUCKDB_API void AddReadAheadStatistics(idx_t hits, idx_t misses);
+	//! Adds the number of row groups that a table scan skipped because the filters ruled them out
+	DUCKDB_API void AddPrunedRowGroups(idx_t count);
+	//! Appends information that is only known at runtime (e.g., a cardinality misestimate) to the extra info of an
+	//! operator
+	DUCKDB_API void AppendOperatorInfo(const PhysicalOperator &op, const string &info);
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -149,6 +156,12 @@ private:
 	TreeMap tree_map;
 	//! Whether or not we are running as part of a explain_analyze query
 	bool is_explain_analyze;
+	//! The number of blocks that were loaded by the table scan read-ahead before the scan reached them
+	idx_t read_ahead_hits = 0;
+	//! The number of blocks that the table scan read-ahead did not load before the scan reached them
+	idx_t read_ahead_misses = 0;
+	//! The number of row groups that table scans skipped because the filters ruled them out
+	idx_t pruned_row_groups = 0;
 
 public:
 	const TreeMap &GetTreeMap() const {
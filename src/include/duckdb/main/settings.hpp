@@ -62,6 +62,36 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundEvictionSetting {
+	static constexpr const char *Name = "background_eviction";
+	static constexpr const char *Description =
+	    "Whether a background thread evicts blocks ahead of time when the used memory exceeds background_eviction_high_watermark";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BackgroundEvictionHighWatermarkSetting {
+	static constexpr const char *Name = "background_eviction_high_watermark";
+	static constexpr const char *Description =
+	    "The fraction of the memory limit above which the background thread starts evicting blocks";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BackgroundEvictionLowWatermarkSetting {
+	static constexpr const char *Name = "background_eviction_low_watermark";
+	static constexpr const char *Description =
+	    "The fraction of the memory limit that the background thread evicts blocks down to";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -177,6 +207,17 @@ struct DefaultSecretStorage {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct DirectIOSetting {
+	static constexpr const char *Name = "direct_io";
+	static constexpr const char *Description =
+	    "Whether database files and temporary files are read and written with direct I/O, bypassing the operating "
+	    "system page cache";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DisabledFileSystemsSetting {
 	static constexpr const char *Name = "disabled_filesystems";
 	static constexpr const char *Description = "Disable specific file systems preventing access (e.g. LocalFileSystem)";
@@ -206,6 +247,26 @@ struct EnableExternalAccessSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableJoinFilterPushdownSetting {
+	static constexpr const char *Name = "enable_join_filter_pushdown";
+	static constexpr const char *Description =
+	    "Whether hash joins push the range of their build side keys into the table scans of their probe side";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableJoinRoleReversalSetting {
+	static constexpr const char *Name = "enable_join_role_reversal";
+	static constexpr const char *Description =
+	    "Whether hash joins swap their build and probe side at runtime if the build side turns out to be much larger";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableFSSTVectors {
 	static constexpr const char *Name = "enable_fsst_vectors";
 	static constexpr const char *Description =
@@ -216,6 +277,28 @@ struct EnableFSSTVectors {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableRowGroupBloomFiltersSetting {
+	static constexpr const char *Name = "enable_row_group_bloom_filters";
+	static constexpr const char *Description =
+	    "Build bloom filters for the columns of each row group when checkpointing, these are used to skip row groups "
+	    "for equality and IN filters";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ScanReadAheadDepthSetting {
+	static constexpr const char *Name = "scan_read_ahead_depth";
+	static constexpr const char *Description =
+	    "The number of row groups that table scans load in the background ahead of the row group they are scanning "
+	    "(0 = disabled)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowUnsignedExtensionsSetting {
 	static constexpr const char *Name = "allow_unsigned_extensions";
 	static constexpr const char *Description = "Allow to load extensions with invalid or missing signatures";
@@ -339,6 +422,16 @@ struct ErrorsAsJsonSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EvictionPolicySetting {
+	static constexpr const char *Name = "eviction_policy";
+	static constexpr const char *Description =
+	    "The policy that decides which blocks the buffer manager evicts first (lru or 2q)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ExplainOutputSetting {
 	static constexpr const char *Name = "explain_output";
 	static constexpr const char *Description = "Output of EXPLAIN statements (ALL, OPTIMIZED_ONLY, PHYSICAL_ONLY)";
@@ -481,6 +574,27 @@ struct MaximumTempDirectorySize {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MmapReadOnlySetting {
+	static constexpr const char *Name = "mmap_read_only";
+	static constexpr const char *Description =
+	    "Whether database files that are attached read-only are memory mapped, so that their blocks are read from the "
+	    "page cache instead of being copied into the buffer pool";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct NumaAwareSchedulingSetting {
+	static constexpr const char *Name = "numa_aware_scheduling";
+	static constexpr const char *Description =
+	    "Whether to pin the threads to NUMA nodes and prefer running tasks on the node that scheduled them";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct OldImplicitCasting {
 	static constexpr const char *Name = "old_implicit_casting";
 	static constexpr const char *Description = "Allow implicit casting to/from VARCHAR";
@@ -490,6 +604,17 @@ struct OldImplicitCasting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PartitionedHashJoinThresholdSetting {
+	static constexpr const char *Name = "partitioned_hash_join_threshold";
+	static constexpr const char *Description =
+	    "The minimum size of an in-memory hash join's hash table for which it is built and probed in cache-sized radix "
+	    "partitions";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PartitionedWriteFlushThreshold {
 	static constexpr const char *Name = "partitioned_write_flush_threshold";
 	static constexpr const char *Description =
@@ -587,6 +712,18 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The memory budget of each query for its operators (e.g. 1GB). Queries wait until their budget is available";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -616,6 +753,16 @@ struct SecretDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SlabAllocatorSetting {
+	static constexpr const char *Name = "slab_allocator";
+	static constexpr const char *Description =
+	    "Whether the blocks of the buffer pool are allocated from a slab allocator that is backed by huge pages";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct TempDirectorySetting {
 	static constexpr const char *Name = "temp_directory";
 	static constexpr const char *Description = "Set the directory to which to write temp files";
@@ -625,6 +772,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "How to compress the buffers that are written to the temporary directory (none or zstd)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
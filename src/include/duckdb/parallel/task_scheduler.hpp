@@ -46,7 +46,8 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
 	unique_ptr<ProducerToken> CreateProducer();
-	//! Schedule a task to be executed by the task scheduler
+	//! Schedule a task to be executed by the task scheduler. Tasks scheduled by a worker thread are placed in the deque
+	//! of that worker, where it runs them in LIFO order, and other threads can steal them when they are idle.
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
@@ -82,7 +83,7 @@ private:
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
+	//! The task queue - with NUMA-aware scheduling there is a queue per node, and threads prefer the tasks of their node
 	unique_ptr<ConcurrentQueue> queue;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
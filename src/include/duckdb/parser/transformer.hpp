@@ -280,6 +280,8 @@ private:
 	string TransformCollation(optional_ptr<duckdb_libpgquery::PGCollateClause> collate);
 
 	ColumnDefinition TransformColumnDefinition(duckdb_libpgquery::PGColumnDef &cdef);
+	//! Transform the WITH (...) options of a CREATE TABLE statement
+	void TransformTableOptions(optional_ptr<duckdb_libpgquery::PGList> options, CreateTableInfo &info);
 	//===--------------------------------------------------------------------===//
 	// Helpers
 	//===--------------------------------------------------------------------===//
@@ -37,8 +37,10 @@ public:
 	ConjunctionOrFilter();
 
 public:
-	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	bool CheckBloomFilter(const BloomFilter &bloom_filter) override;
 	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
 	bool Equals(const TableFilter &other) const override;
 	void Serialize(Serializer &serializer) const override;
 	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
@@ -52,8 +54,10 @@ public:
 	ConjunctionAndFilter();
 
 public:
-	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	bool CheckBloomFilter(const BloomFilter &bloom_filter) override;
 	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
 	bool Equals(const TableFilter &other) const override;
 	void Serialize(Serializer &serializer) const override;
 	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
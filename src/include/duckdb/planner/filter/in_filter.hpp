@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+
+namespace duckdb {
+
+//! InFilter represents "column IN (constant, constant, ...)" with a (potentially large) list of constants
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The constants to filter on - sorted, without duplicates and without NULL values
+	vector<Value> values;
+	//! The constants as a flat vector of the column type, in the same (sorted) order, used to probe during scans
+	Vector sorted_values;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	bool CheckBloomFilter(const BloomFilter &bloom_filter) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() const override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+	//! Whether or not an InFilter can be created for constants of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+	//! Returns true if the (sorted) constant array contains the given value
+	template <class T>
+	static bool Contains(const T *constants, idx_t count, const T &value) {
+		idx_t lower = 0;
+		idx_t upper = count;
+		while (lower < upper) {
+			auto middle = lower + (upper - lower) / 2;
+			if (duckdb::LessThan::Operation<T>(constants[middle], value)) {
+				lower = middle + 1;
+			} else {
+				upper = middle;
+			}
+		}
+		return lower < count && duckdb::Equals::Operation<T>(constants[lower], value);
+	}
+};
+
+} // namespace duckdb
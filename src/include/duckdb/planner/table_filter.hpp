@@ -10,11 +10,15 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class BloomFilter;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
@@ -22,7 +26,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	IN_FILTER = 6 // IN-list of constants (e.g. IN (C1, C2, ...))
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -37,8 +42,13 @@ public:
 
 public:
 	//! Returns true if the statistics indicate that the segment can contain values that satisfy that filter
-	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) = 0;
+	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) const = 0;
+	//! Returns false if the bloom filter (built over the hashes of the values) proves that no value satisfies the filter
+	virtual bool CheckBloomFilter(const BloomFilter &bloom_filter) {
+		return true;
+	}
 	virtual string ToString(const string &column_name) = 0;
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
@@ -100,4 +110,22 @@ public:
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet holds the filters that operators push into a table scan while the query is running, e.g., the
+//! range of the join keys on the build side of a hash join. The filters are picked up when the scan is initialized.
+class DynamicTableFilterSet {
+public:
+	//! Removes the filters that were pushed by the operator, e.g., when the operator is executed again
+	void ClearFilters(const PhysicalOperator &op);
+	//! Pushes a filter on the column with the given index (in the column ids of the scan)
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+
+	bool HasFilters() const;
+	//! Returns the combination of the given filters and the dynamic filters
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
 
 namespace duckdb {
 class BlockHandle;
@@ -21,6 +22,17 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A range of consecutive blocks that is read into a single buffer
+struct BlockRangeRead {
+	BlockRangeRead(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	FileBuffer &buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implements how blocks are stored.
 class BlockManager {
@@ -51,6 +63,21 @@ public:
 	virtual idx_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Read the content of a range of consecutive blocks from disk into a single buffer
+	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count);
+	//! Read multiple ranges of consecutive blocks from disk, each into its own buffer
+	virtual void ReadBlocks(vector<BlockRangeRead> &ranges);
+	//! Whether or not reading consecutive blocks with ReadBlocks is supported (and worthwhile)
+	virtual bool CanReadBlocks() {
+		return false;
+	}
+	//! Whether or not the persistent blocks are views into a memory mapping of the file. Such blocks are not copied
+	//! into memory of the buffer pool, and are never evicted.
+	virtual bool IsMemoryMapped() const {
+		return false;
+	}
+	//! Returns a block that refers directly to the memory mapping of the file (only if IsMemoryMapped)
+	virtual unique_ptr<Block> MapBlock(block_id_t block_id);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -68,8 +95,8 @@ public:
 	//! Truncate the underlying database file after a checkpoint
 	virtual void Truncate();
 
-	//! Register a block with the given block id in the base file
-	shared_ptr<BlockHandle> RegisterBlock(block_id_t block_id);
+	//! Register a block with the given block id in the base file. The tag is used if the block is not registered yet.
+	shared_ptr<BlockHandle> RegisterBlock(block_id_t block_id, MemoryTag tag = MemoryTag::BASE_TABLE);
 	//! Convert an existing in-memory buffer into a persistent disk-backed block
 	shared_ptr<BlockHandle> ConvertToPersistent(block_id_t block_id, shared_ptr<BlockHandle> old_block);
 
@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/block_allocator.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/set.hpp"
+
+namespace duckdb {
+
+//! Statistics of the BlockAllocator
+struct BlockAllocatorInformation {
+	//! Whether the block allocator is used for new blocks
+	bool enabled;
+	//! Whether the regions of the block allocator are backed by huge pages
+	bool huge_pages;
+	//! The size of the blocks that are allocated from the regions
+	idx_t block_size;
+	//! The amount of regions that are currently allocated
+	idx_t region_count;
+	//! The amount of memory that is reserved by the regions (in bytes)
+	idx_t reserved_memory;
+	//! The amount of blocks that are currently in use
+	idx_t used_blocks;
+	//! The amount of blocks that are allocated but not in use
+	idx_t free_blocks;
+	//! The total amount of allocated blocks
+	idx_t allocations;
+	//! The amount of allocations that were served by recycling a freed block
+	idx_t recycled_allocations;
+	//! The amount of allocations that could not be served from a region and went to the default allocator
+	idx_t fallback_allocations;
+};
+
+//! The BlockAllocator is a slab allocator for the fixed-size blocks of the buffer pool. Blocks are carved out of large,
+//! aligned memory regions that are backed by transparent huge pages where the operating system supports it, which
+//! reduces TLB misses when scanning many blocks. Freed blocks are kept in the free list of their region and are handed
+//! out again without going through malloc. A region that becomes entirely free is returned to the operating system,
+//! except for a single region that is kept around to absorb allocation bursts.
+class BlockAllocator {
+public:
+	explicit BlockAllocator(idx_t block_size);
+	~BlockAllocator();
+
+	//! The size of a region, a multiple of the huge page size
+	static constexpr const idx_t REGION_SIZE = 32ULL * 1024ULL * 1024ULL;
+	//! The size of a (transparent) huge page
+	static constexpr const idx_t HUGE_PAGE_SIZE = 2ULL * 1024ULL * 1024ULL;
+
+public:
+	//! Returns the allocator through which FileBuffers allocate from the block allocator. Allocations of any other size
+	//! than the block size, e.g., when a buffer is resized, are passed on to the default allocator.
+	Allocator &GetAllocator();
+	//! Whether the block allocator should be used for new blocks. Blocks that are already allocated from the block
+	//! allocator are always returned to it.
+	void SetEnabled(bool enabled);
+	bool IsEnabled() const;
+
+	//! Allocates a block, returns nullptr if no region could be allocated
+	data_ptr_t AllocateBlock();
+	//! Returns true if the pointer was allocated by AllocateBlock
+	bool IsBlock(data_ptr_t pointer);
+	//! Returns a block to the free list of its region, returns false if the pointer was not allocated by AllocateBlock
+	bool FreeBlock(data_ptr_t pointer);
+	//! Count an allocation of block size that had to go to the default allocator
+	void CountFallbackAllocation();
+
+	idx_t GetBlockSize() const {
+		return block_size;
+	}
+	BlockAllocatorInformation GetInformation();
+
+private:
+	struct BlockRegion {
+		//! The start of the region
+		data_ptr_t base;
+		//! The amount of blocks of the region that are in use
+		idx_t used_blocks;
+		//! The amount of blocks of the region that have been handed out at least once
+		idx_t initialized_blocks;
+		//! The indexes of the blocks of the region that were freed
+		vector<uint32_t> free_list;
+	};
+
+	//! Returns the region that the pointer belongs to, or nullptr if it does not belong to any region
+	BlockRegion *GetRegion(data_ptr_t pointer);
+	//! Map a new region
+	BlockRegion *CreateRegion();
+	//! Unmap a region that has no blocks in use
+	void DestroyRegion(BlockRegion &region);
+
+private:
+	//! The size of the blocks
+	const idx_t block_size;
+	//! The amount of blocks per region
+	const idx_t blocks_per_region;
+	//! The allocator that routes FileBuffer allocations to this block allocator
+	Allocator allocator;
+	//! Whether the block allocator is used for new blocks
+	atomic<bool> enabled;
+	//! Whether the regions were marked to be backed by huge pages
+	bool huge_pages;
+
+	//! The lock for the regions
+	mutex lock;
+	//! The regions by their start address
+	map<data_ptr_t, unique_ptr<BlockRegion>> regions;
+	//! The start addresses of the regions that have blocks available. Blocks are allocated from the region with the
+	//! lowest address first, so that regions at the end of the address space can become empty and be released.
+	set<data_ptr_t> available_regions;
+	//! The start address of the empty region that is kept around, if any
+	data_ptr_t empty_region;
+
+	//! Allocation statistics
+	idx_t allocations;
+	idx_t recycled_allocations;
+	atomic<idx_t> fallback_allocations;
+};
+
+} // namespace duckdb
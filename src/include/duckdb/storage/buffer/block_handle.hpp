@@ -103,9 +103,16 @@ public:
 	bool IsUnloaded() {
 		return state == BlockState::BLOCK_UNLOADED;
 	}
+	//! Whether the block is a view into a memory-mapped file, such blocks do not use memory of the buffer pool
+	bool IsMemoryMapped() const {
+		return memory_mapped;
+	}
 
 private:
 	static BufferHandle Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileBuffer> buffer = nullptr);
+	//! Load the block from the contents of a block that has already been read from disk
+	static BufferHandle LoadFromBuffer(shared_ptr<BlockHandle> &handle, data_ptr_t data,
+	                                   unique_ptr<FileBuffer> reusable_buffer);
 	unique_ptr<FileBuffer> UnloadAndTakeBlock();
 	void Unload();
 	bool CanUnload();
@@ -120,12 +127,19 @@ private:
 	const block_id_t block_id;
 	//! Memory tag
 	MemoryTag tag;
+	//! Whether the block is loaded as a view into the memory mapping of its block manager
+	const bool memory_mapped;
 	//! Pointer to loaded data (if any)
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction sequence number
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! The eviction queue that the latest eviction node of the block was added to
+	atomic<idx_t> eviction_queue_idx;
+	//! The amount of distinct accesses of the block since it was last evicted from a protected eviction queue. Only pins
+	//! of a block that is not pinned yet count: nested pins and the pins of read-ahead loads are not accesses
+	atomic<idx_t> access_count;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
@@ -10,12 +10,15 @@
 
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer/eviction_policy.hpp"
 
 namespace duckdb {
 
 class TemporaryMemoryManager;
 struct EvictionQueue;
+struct BackgroundEvictionState;
 
 struct BufferEvictionNode {
 	BufferEvictionNode() {
@@ -29,8 +32,29 @@ struct BufferEvictionNode {
 	shared_ptr<BlockHandle> TryGetBlockHandle();
 };
 
+//! Eviction statistics of the BufferPool
+struct BufferPoolEvictionStatistics {
+	//! Whether blocks are evicted by a background thread
+	bool background_eviction;
+	//! The used memory above which the background thread starts evicting blocks (in bytes)
+	idx_t high_watermark;
+	//! The used memory that the background thread evicts blocks down to (in bytes)
+	idx_t low_watermark;
+	//! The amount of reservations of memory in the buffer pool
+	idx_t reservations;
+	//! The amount of reservations that had to evict blocks themselves, because the memory limit was reached
+	idx_t inline_evictions;
+	//! The amount of blocks that were evicted by reservations
+	idx_t inline_evicted_blocks;
+	//! The amount of times that the background thread evicted blocks
+	idx_t background_evictions;
+	//! The amount of blocks that were evicted by the background thread
+	idx_t background_evicted_blocks;
+};
+
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
-//! and implements priority eviction among all users of the pool.
+//! and implements priority eviction among all users of the pool. Unpinned blocks are placed in one of several eviction
+//! queues by the EvictionPolicy, the queues are evicted one after the other.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
@@ -38,9 +62,13 @@ class BufferPool {
 	friend class StandardBufferManager;
 
 public:
-	explicit BufferPool(idx_t maximum_memory, bool track_eviction_timestamps);
+	BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
+	           EvictionPolicyType eviction_policy = EvictionPolicyType::LRU, bool use_block_allocator = false);
 	virtual ~BufferPool();
 
+	//! The number of eviction queues: one per priority and segment
+	static constexpr const idx_t EVICTION_QUEUE_COUNT = 4;
+
 	//! Set a new memory limit to the buffer pool, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
 	void SetLimit(idx_t limit, const char *exception_postscript);
@@ -55,6 +83,21 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Get the slab allocator for the blocks of the buffer pool
+	BlockAllocator &GetBlockAllocator();
+
+	//! Start or stop the thread that evicts blocks in the background. When the used memory exceeds the high
+	//! watermark, the thread evicts blocks until the used memory is below the low watermark, so that queries do not
+	//! have to evict (and write out) blocks themselves.
+	void SetBackgroundEviction(bool enabled);
+	//! Set the watermarks of background eviction, as fractions of the memory limit
+	void SetBackgroundEvictionWatermarks(double low_watermark, double high_watermark);
+	BufferPoolEvictionStatistics GetEvictionStatistics() const;
+
+	//! Set the policy that decides in which eviction queue unpinned blocks are placed. Blocks that are already in an
+	//! eviction queue stay there until they are used again.
+	void SetEvictionPolicy(unique_ptr<EvictionPolicy> policy);
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -72,31 +115,31 @@ protected:
 	//! Purge all blocks that haven't been pinned within the last N seconds
 	idx_t PurgeAgedBlocks(uint32_t max_age_sec);
 
-	//! Iterate over all purgable blocks and invoke the callback. If the callback returns true
-	//! iteration continues.
+	//! Iterate over all purgable blocks of an eviction queue and invoke the callback, which has to unload the block.
+	//! If the callback returns true iteration continues.
 	//! - Callback signature is: bool((BufferEvictionNode &, const std::shared_ptr<BlockHandle> &)
 	//! - Callback is invoked while holding the corresponding BlockHandle mutex.
 	template <typename FN>
-	void IterateUnloadableBlocks(FN fn);
+	void IterateUnloadableBlocks(idx_t queue_idx, FN fn);
 
-	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
-	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
-	//! Garbage collect dead nodes in the eviction queue.
+	//! Garbage collect dead nodes in the eviction queues.
 	void PurgeQueue();
-	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
+	//! Add a buffer handle to the eviction queue that the eviction policy picks for it. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 
-	//! Increment the dead node counter in the purge queue.
-	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
-	}
-	//! Decrement the dead node counter in the purge queue.
-	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
-	}
+	//! Increment the dead node counter of the eviction queue that the latest node of the handle was added to.
+	void IncrementDeadNodes(BlockHandle &handle);
+
+private:
+	//! Evict blocks until the used memory is below the memory limit, returns the amount of evicted blocks
+	idx_t EvictBlocksInBackground(idx_t memory_limit);
+	//! The main loop of the background eviction thread
+	void RunBackgroundEviction(BackgroundEvictionState &state);
+	//! Wake up the background eviction thread
+	void RequestBackgroundEviction();
+	//! Recompute the used memory at which background eviction is requested, after the limit or watermarks changed
+	void UpdateBackgroundEvictionThreshold();
 
 protected:
 	//! The lock for changing the memory limit
@@ -107,35 +150,37 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! The eviction queues, ordered by the order in which they are evicted
+	vector<unique_ptr<EvictionQueue>> queues;
+	//! The current eviction policy
+	atomic<EvictionPolicy *> eviction_policy;
+	//! All eviction policies that were set - a policy can still be in use by a concurrent unpin after it is replaced
+	vector<unique_ptr<EvictionPolicy>> eviction_policies;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
+	//! Slab allocator for the blocks of the buffer pool
+	unique_ptr<BlockAllocator> block_allocator;
 	//! Memory usage per tag
 	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
 
-	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
-	constexpr static idx_t INSERT_INTERVAL = 4096;
-	//! We multiply the base purge size by this value.
-	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
-	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
-	//! We never purge below this point.
-	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
-	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
-	//! exceed their allowed ratio. Must be greater than 1.
-	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
-
-	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
-	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
-	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
-	//! Only lets a single thread enter the purge phase.
-	mutex purge_lock;
-
-	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
-	vector<BufferEvictionNode> purge_nodes;
+	//! The state of the background eviction thread, if it is running
+	unique_ptr<BackgroundEvictionState> background_eviction;
+	//! The lock for starting and stopping background eviction
+	mutex background_eviction_lock;
+	//! The watermarks of background eviction, as fractions of the memory limit
+	atomic<double> background_eviction_low_watermark;
+	atomic<double> background_eviction_high_watermark;
+	//! The used memory above which background eviction is requested (the high watermark in bytes, or the maximum
+	//! value when background eviction is disabled)
+	atomic<idx_t> background_eviction_threshold;
+	//! Whether background eviction was requested and has not been performed yet
+	atomic<bool> background_eviction_requested;
+	//! Eviction statistics
+	atomic<idx_t> reservation_count;
+	atomic<idx_t> inline_eviction_count;
+	atomic<idx_t> inline_evicted_block_count;
+	atomic<idx_t> background_eviction_count;
+	atomic<idx_t> background_evicted_block_count;
 };
 
 } // namespace duckdb
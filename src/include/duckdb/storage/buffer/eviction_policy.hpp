@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
+
+namespace duckdb {
+
+//! The built-in eviction policies of the buffer pool
+enum class EvictionPolicyType : uint8_t {
+	//! Evict the least recently unpinned blocks first
+	LRU = 0,
+	//! Scan-resistant: blocks that were only used once are evicted before blocks that were used repeatedly
+	TWO_QUEUE = 1
+};
+
+//! The priority of a block, blocks with a lower priority are always evicted first
+enum class EvictionPriority : uint8_t { NORMAL = 0, HIGH = 1 };
+
+//! Within a priority, the blocks in the probationary segment are evicted before the blocks in the protected segment
+enum class EvictionSegment : uint8_t { PROBATIONARY = 0, PROTECTED = 1 };
+
+//! The EvictionPolicy decides in which of the eviction queues of the BufferPool an unpinned block is placed.
+//! Each queue is evicted in least recently unpinned order.
+class EvictionPolicy {
+public:
+	virtual ~EvictionPolicy() {
+	}
+
+	//! Returns the priority of blocks with the given tag. By default metadata and index blocks are kept in memory
+	//! over other blocks.
+	virtual EvictionPriority GetPriority(MemoryTag tag) const;
+	//! Returns the segment that an unpinned block is placed in, given the amount of distinct accesses of the block
+	//! since it was last evicted from the protected segment
+	virtual EvictionSegment GetSegment(idx_t access_count) const = 0;
+
+	static unique_ptr<EvictionPolicy> Create(EvictionPolicyType type);
+};
+
+//! Places all blocks in the protected segment, i.e., evicts the least recently used blocks of a priority first
+class LRUEvictionPolicy : public EvictionPolicy {
+public:
+	EvictionSegment GetSegment(idx_t access_count) const override;
+};
+
+//! Places the blocks that were only used once in the probationary segment. A large scan thus only evicts the blocks of
+//! other scans, and does not flush the blocks that are used over and over.
+class TwoQueueEvictionPolicy : public EvictionPolicy {
+public:
+	EvictionSegment GetSegment(idx_t access_count) const override;
+};
+
+} // namespace duckdb
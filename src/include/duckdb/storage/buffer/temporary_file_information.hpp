@@ -9,6 +9,8 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The size of the evicted data in the temporary files (after compression)
+	idx_t evicted_data_on_disk;
 };
 
 struct TemporaryFileInformation {
@@ -40,6 +40,9 @@ public:
 	virtual void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size) = 0;
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
+	//! Load the given (persistent) blocks into memory without pinning them, so they can be pinned later without IO.
+	//! This is best-effort: blocks that do not fit in memory are skipped. Returns the number of blocks that were loaded
+	virtual idx_t Prefetch(vector<shared_ptr<BlockHandle>> &handles);
 
 	//! Returns the currently allocated memory
 	virtual idx_t GetUsedMemory() const = 0;
@@ -88,6 +91,11 @@ public:
 
 	//! Get the manager that assigns reservations for temporary memory, e.g., for query intermediates
 	virtual TemporaryMemoryManager &GetTemporaryMemoryManager();
+	//! Get the allocator for the buffers of blocks, i.e., of buffers of Storage::BLOCK_ALLOC_SIZE
+	virtual Allocator &GetBlockAllocator();
+	//! Get the allocator for buffers that are read from or written to database files and temporary files. With direct
+	//! I/O, its allocations are aligned to the sector size.
+	virtual Allocator &GetIOAllocator();
 
 protected:
 	virtual void PurgeQueue() = 0;
@@ -30,6 +30,8 @@ public:
 	void WriteTableData(Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	//! Returns the physical indexes of the columns the table is kept sorted on (empty if the table has no sort key)
+	vector<PhysicalIndex> GetSortKeyColumns();
 
 	virtual void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) = 0;
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) = 0;
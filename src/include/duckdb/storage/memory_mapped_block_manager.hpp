@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/memory_mapped_block_manager.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/single_file_block_manager.hpp"
+
+namespace duckdb {
+
+//! The MemoryMappedBlockManager reads the blocks of a database file that is opened read-only from a memory mapping of
+//! the file. The blocks are views into the mapping, rather than copies in the buffer pool, so processes that read the
+//! same file share a single copy of its blocks in the page cache. If the file cannot be mapped, the blocks are read
+//! as in the SingleFileBlockManager.
+class MemoryMappedBlockManager : public SingleFileBlockManager {
+public:
+	MemoryMappedBlockManager(AttachedDatabase &db, string path, StorageManagerOptions options);
+	~MemoryMappedBlockManager() override;
+
+	void LoadExistingDatabase() override;
+
+	bool IsMemoryMapped() const override {
+		return mapping != nullptr;
+	}
+	unique_ptr<Block> MapBlock(block_id_t block_id) override;
+	bool CanReadBlocks() override {
+		return !IsMemoryMapped();
+	}
+
+private:
+	//! The memory mapping of the file, or nullptr if the file could not be mapped
+	data_ptr_t mapping;
+	//! The size of the mapping
+	idx_t mapping_size;
+	//! Lock for the verified blocks
+	mutex verified_lock;
+	//! Whether or not the checksum of each block in the mapping has been verified. The checksum of a block is only
+	//! verified the first time it is mapped.
+	vector<bool> verified_blocks;
+};
+
+} // namespace duckdb
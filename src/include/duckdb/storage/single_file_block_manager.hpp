@@ -30,6 +30,7 @@ struct StorageManagerOptions {
 
 //! SingleFileBlockManager is an implementation for a BlockManager which manages blocks in a single file
 class SingleFileBlockManager : public BlockManager {
+protected:
 	//! The location in the file where the block writing starts
 	static constexpr uint64_t BLOCK_START = Storage::FILE_HEADER_SIZE * 3;
 
@@ -38,7 +39,7 @@ public:
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	void CreateNewDatabase();
-	void LoadExistingDatabase();
+	virtual void LoadExistingDatabase();
 
 	//! Creates a new Block using the specified block_id and returns a pointer
 	unique_ptr<Block> ConvertBlock(block_id_t block_id, FileBuffer &source_buffer) override;
@@ -57,6 +58,12 @@ public:
 	idx_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	//! Read the content of a range of consecutive blocks from disk into a single buffer
+	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	void ReadBlocks(vector<BlockRangeRead> &ranges) override;
+	bool CanReadBlocks() override {
+		return true;
+	}
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -69,6 +76,10 @@ public:
 	//! Returns the number of free blocks
 	idx_t FreeBlocks() override;
 
+protected:
+	//! Verify the checksums of the consecutive blocks that were read from "location" into the buffer
+	void VerifyBlockChecksums(FileBuffer &buffer, idx_t location, idx_t block_count) const;
+
 private:
 	//! Load the free list from the file
 	void LoadFreeList();
@@ -82,14 +93,16 @@ private:
 	vector<MetadataHandle> GetFreeListBlocks();
 	void TrimFreeBlocks();
 
-private:
+protected:
 	AttachedDatabase &db;
-	//! The active DatabaseHeader, either 0 (h1) or 1 (h2)
-	uint8_t active_header;
 	//! The path where the file is stored
 	string path;
 	//! The file handle
 	unique_ptr<FileHandle> handle;
+
+private:
+	//! The active DatabaseHeader, either 0 (h1) or 1 (h2)
+	uint8_t active_header;
 	//! The buffer used to read/write to the headers
 	FileBuffer header_buffer;
 	//! The list of free blocks that can be written to currently
@@ -11,6 +11,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -24,6 +25,7 @@ class TemporaryMemoryManager;
 class DatabaseInstance;
 class TemporaryDirectoryHandle;
 struct EvictionQueue;
+struct BlockRangeRead;
 
 //! The BufferManager is in charge of handling memory management for a single database. It cooperatively shares a
 //! BufferPool with other BufferManagers, belonging to different databases. It hands out memory buffers that can
@@ -63,6 +65,7 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
+	idx_t Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
@@ -111,8 +114,15 @@ protected:
 	//! Garbage collect eviction queue
 	void PurgeQueue() final;
 
+	//! Load the unloaded blocks of a range of consecutive blocks that was read into a single buffer. Returns false if
+	//! there was not enough memory to load the blocks.
+	bool LoadReadBlocks(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	                    BlockRangeRead &range, idx_t &loaded_count);
+
 	BufferPool &GetBufferPool() const final;
 	TemporaryMemoryManager &GetTemporaryMemoryManager() final;
+	Allocator &GetBlockAllocator() final;
+	Allocator &GetIOAllocator() final;
 
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) final;
@@ -135,6 +145,11 @@ protected:
 	static data_ptr_t BufferAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
 	                                         idx_t size);
 
+	static data_ptr_t DirectIOAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size);
+	static void DirectIOAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size);
+	static data_ptr_t DirectIOAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer,
+	                                           idx_t old_size, idx_t size);
+
 	//! When the BlockHandle reaches 0 readers, this creates a new FileBuffer for this BlockHandle and
 	//! overwrites the data within with garbage. Any readers that do not hold the pin will notice
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
@@ -164,10 +179,15 @@ protected:
 	atomic<block_id_t> temporary_id;
 	//! Allocator associated with the buffer manager, that passes all allocations through this buffer manager
 	Allocator buffer_allocator;
+	//! Allocator for the buffers that are read from or written to files with direct I/O, aligns allocations to the
+	//! sector size
+	Allocator direct_io_allocator;
 	//! Block manager for temp data
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
 	atomic<idx_t> evicted_data_per_tag[MEMORY_TAG_COUNT];
+	//! The size of the temporary evicted memory data in the temporary files per tag
+	atomic<idx_t> evicted_data_on_disk_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
@@ -15,6 +15,7 @@
 
 namespace duckdb {
 struct FileHandle;
+class FileBuffer;
 
 //! The standard row group size
 #define STANDARD_ROW_GROUPS_SIZE 122880
@@ -63,7 +64,9 @@ struct MainHeader {
 	uint64_t version_number;
 	//! The set of flags used by the database
 	uint64_t flags[FLAG_COUNT];
-	static void CheckMagicBytes(FileHandle &handle);
+	//! Check the magic bytes of the file, reading its main header into the given buffer. The whole header is read, as
+	//! reads with direct I/O must be aligned to the sector size
+	static void CheckMagicBytes(FileHandle &handle, FileBuffer &header_buffer);
 
 	string LibraryGitDesc() {
 		return string(char_ptr_cast(library_git_desc), 0, MAX_VERSION_SIZE);
@@ -75,6 +75,9 @@ public:
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
 	bool InMemory();
+	//! Request that the next checkpoint is performed even if there are no changes in the WAL, e.g., to compact a
+	//! table on which VACUUM was run
+	void RequestCheckpoint();
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
 	virtual unique_ptr<StorageCommitState> GenStorageCommitState(Transaction &transaction, bool checkpoint) = 0;
@@ -99,6 +102,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Whether the next checkpoint is performed even if there are no changes in the WAL
+	atomic<bool> checkpoint_requested;
 
 public:
 	template <class TARGET>
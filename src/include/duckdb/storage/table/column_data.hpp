@@ -18,6 +18,7 @@
 #include "duckdb/common/mutex.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -27,6 +28,7 @@ class TableDataWriter;
 class TableStorageInfo;
 struct TransactionData;
 struct TableScanOptions;
+struct PrefetchState;
 
 struct DataTableInfo;
 struct RowGroupWriteInfo;
@@ -84,6 +86,10 @@ public:
 	const LogicalType &RootType() const;
 	//! Whether or not the column has any updates
 	virtual bool HasUpdates() const;
+	//! Whether or not the column has changes (appends or updates) that are not reflected in its on-disk segments
+	virtual bool HasChanges();
+	//! Gather the on-disk blocks that a scan of the column has to read
+	virtual void InitializePrefetch(PrefetchState &prefetch_state);
 
 	//! Initialize a scan of the column
 	virtual void InitializeScan(ColumnScanState &state);
@@ -156,6 +162,11 @@ public:
 	void MergeIntoStatistics(BaseStatistics &other);
 	unique_ptr<BaseStatistics> GetStatistics();
 
+	//! Returns the bloom filter over the values of the column (if any)
+	shared_ptr<BloomFilter> GetBloomFilter();
+	//! Sets the bloom filter over the values of the column
+	void SetBloomFilter(shared_ptr<BloomFilter> filter);
+
 protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
@@ -166,6 +177,10 @@ protected:
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
+	//! Scans a base vector from the column while evaluating the filter directly on the compressed data, pruning
+	//! rows from "sel". Returns false (without scanning anything) if the filter cannot be evaluated this way.
+	bool ScanVectorFiltered(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                        idx_t &approved_tuple_count, const TableFilter &filter, idx_t &scan_count);
 
 	void ClearUpdates();
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
@@ -185,6 +200,9 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The bloom filter over the values of the root segment, built during checkpointing (protected by the stats_lock)
+	//! The filter is dropped as soon as values are appended or updated, as it would no longer cover all values
+	shared_ptr<BloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -16,6 +16,10 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! The number of bits per distinct value used for the row group bloom filters
+	static constexpr idx_t BLOOM_FILTER_BITS_PER_KEY = 10;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -36,6 +40,8 @@ private:
 	void WriteToDisk();
 	bool HasChanges();
 	void WritePersistentSegments();
+	bool ShouldBuildBloomFilter();
+	void CreateBloomFilter(vector<hash_t> &hashes);
 
 private:
 	ColumnData &col_data;
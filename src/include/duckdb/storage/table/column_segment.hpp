@@ -65,6 +65,11 @@ public:
 	void InitializeScan(ColumnScanState &state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, bool entire_vector);
+	//! Scan one vector from this segment, pruning rows from "sel" that do not match the filter on the compressed data
+	void Filter(ColumnScanState &state, idx_t vector_count, Vector &result, SelectionVector &sel,
+	            idx_t &approved_tuple_count, const TableFilter &filter);
+	//! Whether or not the filter can be evaluated on the compressed data of this segment
+	bool SupportsFilter(const TableFilter &filter) const;
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 
@@ -50,6 +50,8 @@ public:
 	unique_ptr<BaseStatistics> GetUpdateStatistics() override;
 
 	void CommitDropColumn() override;
+	bool HasChanges() override;
+	void InitializePrefetch(PrefetchState &prefetch_state) override;
 
 	unique_ptr<ColumnCheckpointState> CreateCheckpointState(RowGroup &row_group,
 	                                                        PartialBlockManager &partial_block_manager) override;
@@ -38,6 +38,7 @@ struct ColumnCheckpointState;
 struct RowGroupPointer;
 struct TransactionData;
 class CollectionScanState;
+struct PrefetchState;
 class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
@@ -58,6 +59,8 @@ struct RowGroupWriteInfo {
 struct RowGroupWriteData {
 	vector<unique_ptr<ColumnCheckpointState>> states;
 	vector<BaseStatistics> statistics;
+	//! Whether the row group is unchanged since the last checkpoint, and its existing metadata can be re-used as-is
+	bool reuse_existing_metadata = false;
 };
 
 class RowGroup : public SegmentBase<RowGroup> {
@@ -100,6 +103,8 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Gather the on-disk blocks that the given scan reads from this row group
+	void InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(TableFilterSet &filters, const vector<column_t> &column_ids);
@@ -133,6 +138,8 @@ public:
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
+	//! Whether or not the row group has changes that are not reflected in its on-disk metadata
+	bool HasChanges();
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 
 	void InitializeAppend(RowGroupAppendState &append_state);
@@ -174,6 +181,9 @@ private:
 	idx_t GetColumnCount() const;
 	vector<shared_ptr<ColumnData>> &GetColumns();
 
+	//! Request the blocks of the upcoming row groups when the scan enters this row group (if enabled)
+	void InitializeReadAhead(CollectionScanState &state);
+
 	template <TableScanType TYPE>
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 
@@ -184,6 +194,8 @@ private:
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
+	//! The metadata blocks used by the on-disk metadata of the (loaded) columns
+	vector<MetaBlockPointer> column_metadata_blocks;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
@@ -93,6 +93,8 @@ public:
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
+	void SortRowGroups(CollectionCheckpointState &checkpoint_state, VacuumState &state,
+	                   const vector<PhysicalIndex> &sort_key);
 	void ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
 
 	void CommitDropColumn(idx_t index);
@@ -111,6 +113,8 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Rewrite all row groups that have deleted rows during the next checkpoint
+	void RequestCompaction();
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
@@ -142,6 +146,8 @@ private:
 	shared_ptr<RowGroupSegmentTree> row_groups;
 	//! Table statistics
 	TableStatistics stats;
+	//! Whether all row groups with deleted rows should be rewritten during the next checkpoint
+	atomic<bool> compaction_requested;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
 };
@@ -14,6 +14,8 @@
 #include "duckdb/common/enums/scan_options.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/storage/table/segment_lock.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/unordered_set.hpp"
 
 namespace duckdb {
 class ColumnSegment;
@@ -31,6 +33,11 @@ class TableFilterSet;
 class ColumnData;
 class DuckTransaction;
 class RowGroupSegmentTree;
+class BlockHandle;
+class BufferManager;
+class DatabaseInstance;
+struct ProducerToken;
+class TaskScheduler;
 struct TableScanOptions;
 
 struct SegmentScanState {
@@ -105,8 +112,48 @@ struct ColumnFetchState {
 	buffer_handle_set_t handles;
 	//! Any child states of the fetch
 	vector<unique_ptr<ColumnFetchState>> child_states;
+	//! The scan states of the segments that are fetched from, for compression methods that decompress more than a
+	//! single row at a time
+	unordered_map<const ColumnSegment *, unique_ptr<SegmentScanState>> scan_states;
 
 	BufferHandle &GetOrInsertHandle(ColumnSegment &segment);
+	SegmentScanState &GetOrInsertScanState(ColumnSegment &segment);
+};
+
+//! The on-disk blocks that a scan reads, gathered so they can be loaded ahead of the scan
+struct PrefetchState {
+	vector<shared_ptr<BlockHandle>> blocks;
+	unordered_set<block_id_t> block_ids;
+
+public:
+	void AddBlock(shared_ptr<BlockHandle> block);
+};
+
+//! Loads the blocks of the row groups following the one being scanned in the background
+class RowGroupReadAhead {
+public:
+	explicit RowGroupReadAhead(DatabaseInstance &db);
+	~RowGroupReadAhead();
+
+	//! The number of blocks that were loaded by the read-ahead. Without background threads there is no read-ahead, so
+	//! this is always zero
+	atomic<idx_t> hits;
+	//! The number of blocks that were not loaded yet when the scan reached them, and that the scan had to load itself
+	idx_t misses = 0;
+
+public:
+	//! Called when the scan enters a row group - requests the blocks of the next "depth" row groups
+	void EnterRowGroup(RowGroup &row_group, CollectionScanState &state, idx_t depth);
+
+private:
+	TaskScheduler &scheduler;
+	BufferManager &buffer_manager;
+	//! The producer token used to schedule the read-ahead tasks
+	unique_ptr<ProducerToken> token;
+	//! The number of scheduled read-ahead tasks that have not finished yet
+	atomic<idx_t> pending_tasks;
+	//! The row groups starting before this row have been requested already
+	idx_t requested_end = 0;
 };
 
 class CollectionScanState {
@@ -127,6 +174,10 @@ public:
 	idx_t max_row;
 	//! The current batch index
 	idx_t batch_index;
+	//! The read-ahead of upcoming row groups (if enabled)
+	unique_ptr<RowGroupReadAhead> read_ahead;
+	//! The number of row groups that were skipped because their statistics or bloom filters rule out the filters
+	idx_t pruned_row_groups;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -145,6 +196,8 @@ private:
 struct TableScanOptions {
 	//! Test config that forces fetching rows one by one instead of regular scans
 	bool force_fetch_row = false;
+	//! The number of row groups that are loaded in the background ahead of the scan (0 = disabled)
+	idx_t read_ahead_depth = 0;
 };
 
 class TableScanState {
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -48,6 +48,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block on disk
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -75,7 +77,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -88,8 +90,13 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Write the buffer to its slot in the file - or the compressed buffer if the slots in this file are compressed
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of the slots in this file
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -101,6 +108,8 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	//! The size of the slots in this file, files with slots smaller than a block hold compressed buffers
+	const idx_t slot_size;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
@@ -132,6 +141,9 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+	//! The slots of the files holding compressed buffers are a multiple of this size
+	static constexpr idx_t COMPRESSED_SLOT_ALIGNMENT = 32768;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -145,9 +157,12 @@ public:
 		lock_guard<mutex> lock;
 	};
 
-	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
+	//! Write the buffer to one of the temporary files, returns the number of bytes it takes up on disk
+	idx_t WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
+	//! Read the buffer back from the temporary files, "size_on_disk" is set to the number of bytes it took up on disk
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer,
+	                                           idx_t &size_on_disk);
 	void DeleteTemporaryBuffer(block_id_t id);
 	vector<TemporaryFileInformation> GetTemporaryFiles();
 	idx_t GetTotalUsedSpaceInBytes();
@@ -164,6 +179,8 @@ private:
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	//! Compress the buffer (if enabled) and return the size of the slot it should be written to
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 
 private:
 	DatabaseInstance &db;
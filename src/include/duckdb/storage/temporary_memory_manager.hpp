@@ -9,22 +9,73 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
 class TemporaryMemoryManager;
 
+//! The temporary memory of a single query: the states that the query registered, and its memory budget
+struct QueryMemoryState {
+	QueryMemoryState(ClientContext &context_p, string query_p) : context(context_p), query(std::move(query_p)) {
+	}
+
+	//! The context that runs the query
+	ClientContext &context;
+	//! The query
+	string query;
+	//! The memory budget of the query (or INVALID_INDEX if the query has no budget)
+	idx_t memory_limit = DConstants::INVALID_INDEX;
+	//! The sum of reservations of the active states of the query
+	idx_t reservation = 0;
+	//! The sum of the remaining size of the active states of the query
+	idx_t remaining_size = 0;
+	//! The number of active states of the query
+	idx_t state_count = 0;
+	//! Whether the query is admitted (false while it waits for its budget to become available)
+	bool admitted = false;
+	//! Whether the query is still running, i.e., its QueryMemoryAdmission is still alive
+	bool active = false;
+	//! The part of the memory limit that is set aside for this query by admission control
+	idx_t admitted_budget = 0;
+};
+
+//! Information about the temporary memory of a query, as returned by TemporaryMemoryManager::GetQueryInformation
+struct QueryMemoryInformation {
+	string query;
+	idx_t memory_limit;
+	idx_t reservation;
+	idx_t remaining_size;
+	idx_t state_count;
+	bool admitted;
+};
+
+//! Admission of a query by the TemporaryMemoryManager. As long as this is within scope, the budget of the query stays
+//! set aside
+class QueryMemoryAdmission {
+public:
+	QueryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context);
+	~QueryMemoryAdmission();
+
+private:
+	TemporaryMemoryManager &temporary_memory_manager;
+	ClientContext &context;
+};
+
 //! State of the temporary memory to be managed concurrently with other states
 //! As long as this is within scope, it is active
 class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, QueryMemoryState &query,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -42,6 +93,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The query that registered this state
+	QueryMemoryState &query;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -54,9 +107,10 @@ private:
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
 //! to concurrent states, such that their combined memory usage does not exceed the limit
 class TemporaryMemoryManager {
-	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
-	//! but it should not access the private fields!
+	//! TemporaryMemoryState and QueryMemoryAdmission are friend classes so they can access the private methods of this
+	//! class, but they should not access the private fields!
 	friend class TemporaryMemoryState;
+	friend class QueryMemoryAdmission;
 
 public:
 	TemporaryMemoryManager();
@@ -78,6 +132,11 @@ public:
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Admit a query of the context. If the query has a memory budget (query_memory_limit), this waits until the
+	//! budget fits within the memory limit next to the budgets of the queries that are already admitted.
+	unique_ptr<QueryMemoryAdmission> AdmitQuery(ClientContext &context, const string &query);
+	//! Get information about the temporary memory of the current queries
+	vector<QueryMemoryInformation> GetQueryInformation();
 
 private:
 	//! Locks the TemporaryMemoryManager
@@ -92,6 +151,12 @@ private:
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
+	//! Get the state of the current query of the context, creates it if it does not exist yet (must hold the lock)
+	QueryMemoryState &GetQueryState(ClientContext &context, const string &query);
+	//! Remove the state of the query of the context if it is no longer in use (must hold the lock)
+	void TryRemoveQueryState(ClientContext &context);
+	//! Release the admission of the query of the context (called by the destructor of QueryMemoryAdmission)
+	void ReleaseAdmission(ClientContext &context);
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
@@ -114,6 +179,17 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+
+	//! The temporary memory of the current queries
+	reference_map_t<ClientContext, QueryMemoryState> queries;
+	//! Queries that wait to be admitted, in order of arrival
+	deque<idx_t> admission_queue;
+	//! The ticket that is given to the next query that waits to be admitted
+	idx_t next_admission_ticket;
+	//! The sum of the budgets of the admitted queries
+	idx_t admitted_budget;
+	//! Notified when a query is admitted or releases its budget
+	std::condition_variable admission_cv;
 };
 
 } // namespace duckdb
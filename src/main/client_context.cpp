@@ -44,11 +44,14 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/main/client_context_state.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
 
 struct ActiveQueryContext {
 public:
+	//! The admission of the query by the TemporaryMemoryManager (destroyed last, after the executor)
+	unique_ptr<QueryMemoryAdmission> memory_admission;
 	//! The query that is currently being executed
 	string query;
 	//! Prepared statement data
@@ -187,7 +190,10 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 	if (ValidChecker::IsInvalidated(db_inst)) {
 		throw ErrorManager::InvalidatedDatabase(*this, ValidChecker::InvalidatedMessage(db_inst));
 	}
+	// this waits until the memory budget of the query is available
+	auto memory_admission = TemporaryMemoryManager::Get(*this).AdmitQuery(*this, query);
 	active_query = make_uniq<ActiveQueryContext>();
+	active_query->memory_admission = std::move(memory_admission);
 	if (transaction.IsAutoCommit()) {
 		transaction.BeginTransaction();
 	}
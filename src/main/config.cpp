@@ -57,6 +57,9 @@ bool DBConfigOptions::debug_print_bindings = false;
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
+    DUCKDB_GLOBAL(BackgroundEvictionSetting),
+    DUCKDB_GLOBAL(BackgroundEvictionHighWatermarkSetting),
+    DUCKDB_GLOBAL(BackgroundEvictionLowWatermarkSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_LOCAL(DebugForceExternal),
@@ -67,10 +70,15 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
     DUCKDB_GLOBAL(DefaultOrderSetting),
     DUCKDB_GLOBAL(DefaultNullOrderSetting),
+    DUCKDB_GLOBAL(DirectIOSetting),
     DUCKDB_GLOBAL(DisabledFileSystemsSetting),
     DUCKDB_GLOBAL(DisabledOptimizersSetting),
     DUCKDB_GLOBAL(EnableExternalAccessSetting),
+    DUCKDB_LOCAL(EnableJoinFilterPushdownSetting),
+    DUCKDB_LOCAL(EnableJoinRoleReversalSetting),
     DUCKDB_GLOBAL(EnableFSSTVectors),
+    DUCKDB_GLOBAL(EnableRowGroupBloomFiltersSetting),
+    DUCKDB_GLOBAL(ScanReadAheadDepthSetting),
     DUCKDB_GLOBAL(AllowUnsignedExtensionsSetting),
     DUCKDB_GLOBAL(AllowExtensionsMetadataMismatchSetting),
     DUCKDB_GLOBAL(AllowUnredactedSecretsSetting),
@@ -84,6 +92,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
+    DUCKDB_GLOBAL(EvictionPolicySetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
     DUCKDB_GLOBAL(ExternalThreadsSetting),
@@ -98,6 +107,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_GLOBAL(MaximumMemorySetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
+    DUCKDB_GLOBAL(MmapReadOnlySetting),
+    DUCKDB_GLOBAL(NumaAwareSchedulingSetting),
     DUCKDB_GLOBAL(OldImplicitCasting),
     DUCKDB_GLOBAL_ALIAS("memory_limit", MaximumMemorySetting),
     DUCKDB_GLOBAL_ALIAS("null_order", DefaultNullOrderSetting),
@@ -112,11 +123,14 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(ProfilingModeSetting),
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_GLOBAL_LOCAL(QueryMemoryLimitSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
+    DUCKDB_GLOBAL(SlabAllocatorSetting),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
@@ -126,6 +140,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(FlushAllocatorSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
+    DUCKDB_LOCAL(PartitionedHashJoinThresholdSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
     DUCKDB_LOCAL(EnableHTTPLoggingSetting),
     DUCKDB_LOCAL(HTTPLoggingOutputSetting),
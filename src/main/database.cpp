@@ -55,6 +55,10 @@ DatabaseInstance::DatabaseInstance() {
 }
 
 DatabaseInstance::~DatabaseInstance() {
+	if (config.buffer_pool) {
+		// stop evicting blocks in the background, before the blocks of this database are destroyed
+		config.buffer_pool->SetBackgroundEviction(false);
+	}
 	// destroy all attached databases
 	GetDatabaseManager().ResetDatabases(scheduler);
 	// destroy child elements
@@ -217,6 +221,12 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	} else {
 		buffer_manager = make_uniq<StandardBufferManager>(*this, config.options.temporary_directory);
 	}
+	if (config.options.background_eviction) {
+		auto &buffer_pool = GetBufferPool();
+		buffer_pool.SetBackgroundEvictionWatermarks(config.options.background_eviction_low_watermark,
+		                                            config.options.background_eviction_high_watermark);
+		buffer_pool.SetBackgroundEviction(true);
+	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
 	connection_manager = make_uniq<ConnectionManager>();
@@ -376,7 +386,8 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 		config.buffer_pool = std::move(new_config.buffer_pool);
 	} else {
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
-		                                                 config.options.buffer_manager_track_eviction_timestamps);
+		                                                 config.options.buffer_manager_track_eviction_timestamps,
+		                                                 config.options.eviction_policy, config.options.slab_allocator);
 	}
 }
 
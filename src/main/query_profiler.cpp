@@ -72,6 +72,9 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze, bool start
 	root = nullptr;
 	phase_timings.clear();
 	phase_stack.clear();
+	read_ahead_hits = 0;
+	read_ahead_misses = 0;
+	pruned_row_groups = 0;
 
 	main_query.Start();
 }
@@ -287,6 +290,36 @@ void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor
 	operator_timing.name = phys_op.GetName();
 }
 
+void QueryProfiler::AddReadAheadStatistics(idx_t hits, idx_t misses) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	read_ahead_hits += hits;
+	read_ahead_misses += misses;
+}
+
+void QueryProfiler::AddPrunedRowGroups(idx_t count) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	pruned_row_groups += count;
+}
+
+void QueryProfiler::AppendOperatorInfo(const PhysicalOperator &op, const string &info) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	auto &tree_node = entry->second.get();
+	tree_node.extra_info += "\n[INFOSEPARATOR]\n" + info;
+}
+
 void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -393,6 +426,34 @@ void QueryProfiler::QueryTreeToStream(std::ostream &ss) const {
 		ss << "└─────────────────────────────────────┘\n";
 	}
 
+	if (read_ahead_hits + read_ahead_misses > 0) {
+		string hits = "hits: " + to_string(read_ahead_hits);
+		string misses = "misses: " + to_string(read_ahead_misses);
+
+		constexpr idx_t TOTAL_BOX_WIDTH = 39;
+		ss << "┌─────────────────────────────────────┐\n";
+		ss << "│┌───────────────────────────────────┐│\n";
+		ss << "││         Read-Ahead Stats:         ││\n";
+		ss << "││                                   ││\n";
+		ss << "││" + DrawPadded(hits, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "││" + DrawPadded(misses, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "│└───────────────────────────────────┘│\n";
+		ss << "└─────────────────────────────────────┘\n";
+	}
+
+	if (pruned_row_groups > 0) {
+		string pruned = "pruned: " + to_string(pruned_row_groups);
+
+		constexpr idx_t TOTAL_BOX_WIDTH = 39;
+		ss << "┌─────────────────────────────────────┐\n";
+		ss << "│┌───────────────────────────────────┐│\n";
+		ss << "││          Row Group Stats:         ││\n";
+		ss << "││                                   ││\n";
+		ss << "││" + DrawPadded(pruned, TOTAL_BOX_WIDTH - 4) + "││\n";
+		ss << "│└───────────────────────────────────┘│\n";
+		ss << "└─────────────────────────────────────┘\n";
+	}
+
 	constexpr idx_t TOTAL_BOX_WIDTH = 39;
 	ss << "┌─────────────────────────────────────┐\n";
 	ss << "│┌───────────────────────────────────┐│\n";
@@ -510,6 +571,13 @@ string QueryProfiler::ToJSON() const {
 	// JSON cannot have literal control characters in string literals
 	string extra_info = JSONSanitize(query);
 	ss << "   \"extra-info\": \"" + extra_info + "\", \n";
+	if (read_ahead_hits + read_ahead_misses > 0) {
+		ss << "   \"read_ahead_hits\": " + to_string(read_ahead_hits) + ",\n";
+		ss << "   \"read_ahead_misses\": " + to_string(read_ahead_misses) + ",\n";
+	}
+	if (pruned_row_groups > 0) {
+		ss << "   \"pruned_row_groups\": " + to_string(pruned_row_groups) + ",\n";
+	}
 	// print the phase timings
 	ss << "   \"timings\": [\n";
 	const auto &ordered_phase_timings = GetOrderedPhaseTimings();
@@ -13,6 +13,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -78,6 +79,79 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Background Eviction
+//===--------------------------------------------------------------------===//
+void BackgroundEvictionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto enabled = input.GetValue<bool>();
+	if (db) {
+		db->GetBufferPool().SetBackgroundEviction(enabled);
+	}
+	config.options.background_eviction = enabled;
+}
+
+void BackgroundEvictionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	auto enabled = DBConfig().options.background_eviction;
+	if (db) {
+		db->GetBufferPool().SetBackgroundEviction(enabled);
+	}
+	config.options.background_eviction = enabled;
+}
+
+Value BackgroundEvictionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_eviction);
+}
+
+//===--------------------------------------------------------------------===//
+// Background Eviction Watermarks
+//===--------------------------------------------------------------------===//
+static double GetBackgroundEvictionWatermark(const char *name, const Value &input) {
+	auto watermark = input.GetValue<double>();
+	if (watermark <= 0 || watermark > 1) {
+		throw InvalidInputException("%s must be a fraction of the memory limit between 0 (exclusive) and 1, got %f",
+		                            name, watermark);
+	}
+	return watermark;
+}
+
+static void SetBackgroundEvictionWatermarks(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		db->GetBufferPool().SetBackgroundEvictionWatermarks(config.options.background_eviction_low_watermark,
+		                                                    config.options.background_eviction_high_watermark);
+	}
+}
+
+void BackgroundEvictionHighWatermarkSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_eviction_high_watermark = GetBackgroundEvictionWatermark(Name, input);
+	SetBackgroundEvictionWatermarks(db, config);
+}
+
+void BackgroundEvictionHighWatermarkSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_eviction_high_watermark = DBConfig().options.background_eviction_high_watermark;
+	SetBackgroundEvictionWatermarks(db, config);
+}
+
+Value BackgroundEvictionHighWatermarkSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.background_eviction_high_watermark);
+}
+
+void BackgroundEvictionLowWatermarkSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_eviction_low_watermark = GetBackgroundEvictionWatermark(Name, input);
+	SetBackgroundEvictionWatermarks(db, config);
+}
+
+void BackgroundEvictionLowWatermarkSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_eviction_low_watermark = DBConfig().options.background_eviction_low_watermark;
+	SetBackgroundEvictionWatermarks(db, config);
+}
+
+Value BackgroundEvictionLowWatermarkSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.background_eviction_low_watermark);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -357,6 +431,28 @@ Value DefaultSecretStorage::GetSetting(const ClientContext &context) {
 	return config.secret_manager->DefaultStorage();
 }
 
+//===--------------------------------------------------------------------===//
+// Direct IO
+//===--------------------------------------------------------------------===//
+void DirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change direct_io setting while database is running");
+	}
+	config.options.use_direct_io = input.GetValue<bool>();
+}
+
+void DirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change direct_io setting while database is running");
+	}
+	config.options.use_direct_io = DBConfig().options.use_direct_io;
+}
+
+Value DirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
 //===--------------------------------------------------------------------===//
 // Disabled File Systems
 //===--------------------------------------------------------------------===//
@@ -437,6 +533,36 @@ Value EnableExternalAccessSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_external_access);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Join Filter Pushdown
+//===--------------------------------------------------------------------===//
+void EnableJoinFilterPushdownSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_join_filter_pushdown = input.GetValue<bool>();
+}
+
+void EnableJoinFilterPushdownSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_join_filter_pushdown = ClientConfig().enable_join_filter_pushdown;
+}
+
+Value EnableJoinFilterPushdownSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_join_filter_pushdown);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Join Role Reversal
+//===--------------------------------------------------------------------===//
+void EnableJoinRoleReversalSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_join_role_reversal = input.GetValue<bool>();
+}
+
+void EnableJoinRoleReversalSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_join_role_reversal = ClientConfig().enable_join_role_reversal;
+}
+
+Value EnableJoinRoleReversalSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_join_role_reversal);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable FSST Vectors
 //===--------------------------------------------------------------------===//
@@ -453,6 +579,38 @@ Value EnableFSSTVectors::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_fsst_vectors);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Row Group Bloom Filters
+//===--------------------------------------------------------------------===//
+void EnableRowGroupBloomFiltersSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_row_group_bloom_filters = input.GetValue<bool>();
+}
+
+void EnableRowGroupBloomFiltersSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_row_group_bloom_filters = DBConfig().options.enable_row_group_bloom_filters;
+}
+
+Value EnableRowGroupBloomFiltersSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_row_group_bloom_filters);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan Read-Ahead Depth
+//===--------------------------------------------------------------------===//
+void ScanReadAheadDepthSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scan_read_ahead_depth = input.GetValue<uint64_t>();
+}
+
+void ScanReadAheadDepthSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scan_read_ahead_depth = DBConfig().options.scan_read_ahead_depth;
+}
+
+Value ScanReadAheadDepthSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.scan_read_ahead_depth);
+}
+
 //===--------------------------------------------------------------------===//
 // Allow Unsigned Extensions
 //===--------------------------------------------------------------------===//
@@ -709,6 +867,45 @@ Value ErrorsAsJsonSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).errors_as_json ? 1 : 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Eviction Policy
+//===--------------------------------------------------------------------===//
+void EvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto policy = StringUtil::Lower(input.ToString());
+	EvictionPolicyType policy_type;
+	if (policy == "lru") {
+		policy_type = EvictionPolicyType::LRU;
+	} else if (policy == "2q") {
+		policy_type = EvictionPolicyType::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized option for eviction_policy \"%s\", expected lru or 2q", policy);
+	}
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(EvictionPolicy::Create(policy_type));
+	}
+	config.options.eviction_policy = policy_type;
+}
+
+void EvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	auto policy_type = DBConfig().options.eviction_policy;
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(EvictionPolicy::Create(policy_type));
+	}
+	config.options.eviction_policy = policy_type;
+}
+
+Value EvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.eviction_policy) {
+	case EvictionPolicyType::LRU:
+		return "lru";
+	case EvictionPolicyType::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Type not implemented for EvictionPolicyType");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Explain Output
 //===--------------------------------------------------------------------===//
@@ -1033,6 +1230,44 @@ Value MaximumTempDirectorySize::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Mmap Read Only
+//===--------------------------------------------------------------------===//
+void MmapReadOnlySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.mmap_read_only = input.GetValue<bool>();
+}
+
+void MmapReadOnlySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.mmap_read_only = DBConfig().options.mmap_read_only;
+}
+
+Value MmapReadOnlySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.mmap_read_only);
+}
+
+//===--------------------------------------------------------------------===//
+// NUMA Aware Scheduling
+//===--------------------------------------------------------------------===//
+void NumaAwareSchedulingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change numa_aware_scheduling setting while database is running");
+	}
+	config.options.numa_aware_scheduling = input.GetValue<bool>();
+}
+
+void NumaAwareSchedulingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change numa_aware_scheduling setting while database is running");
+	}
+	config.options.numa_aware_scheduling = DBConfig().options.numa_aware_scheduling;
+}
+
+Value NumaAwareSchedulingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.numa_aware_scheduling);
+}
+
 //===--------------------------------------------------------------------===//
 // Old Implicit Casting
 //===--------------------------------------------------------------------===//
@@ -1049,6 +1284,22 @@ Value OldImplicitCasting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.old_implicit_casting);
 }
 
+//===--------------------------------------------------------------------===//
+// Partitioned Hash Join Threshold
+//===--------------------------------------------------------------------===//
+void PartitionedHashJoinThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).partitioned_hash_join_threshold = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void PartitionedHashJoinThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).partitioned_hash_join_threshold = ClientConfig().partitioned_hash_join_threshold;
+}
+
+Value PartitionedHashJoinThresholdSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.partitioned_hash_join_threshold));
+}
+
 //===--------------------------------------------------------------------===//
 // Partitioned Write Flush Threshold
 //===--------------------------------------------------------------------===//
@@ -1251,6 +1502,43 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_memory_limit = DBConfig().options.query_memory_limit;
+}
+
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (query_memory_limit == DConstants::INVALID_INDEX) {
+		// We use INVALID_INDEX to indicate that the value is not set for this connection
+		// use one lower to indicate 'unlimited'
+		query_memory_limit--;
+	}
+	ClientConfig::GetConfig(context).query_memory_limit = query_memory_limit;
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto query_memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+	if (query_memory_limit == DConstants::INVALID_INDEX) {
+		query_memory_limit = DBConfig::GetConfig(context).options.query_memory_limit;
+	}
+	if (query_memory_limit >= DConstants::INVALID_INDEX - 1) {
+		// no limit
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(query_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1308,6 +1596,30 @@ Value SecretDirectorySetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Slab Allocator
+//===--------------------------------------------------------------------===//
+void SlabAllocatorSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto enabled = input.GetValue<bool>();
+	if (db) {
+		db->GetBufferPool().GetBlockAllocator().SetEnabled(enabled);
+	}
+	config.options.slab_allocator = enabled;
+}
+
+void SlabAllocatorSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	auto enabled = DBConfig().options.slab_allocator;
+	if (db) {
+		db->GetBufferPool().GetBlockAllocator().SetEnabled(enabled);
+	}
+	config.options.slab_allocator = enabled;
+}
+
+Value SlabAllocatorSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.slab_allocator);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -1335,6 +1647,37 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto compression = StringUtil::Lower(input.ToString());
+	if (compression == "none") {
+		config.options.temp_file_compression = TemporaryFileCompression::NONE;
+	} else if (compression == "zstd") {
+		config.options.temp_file_compression = TemporaryFileCompression::ZSTD;
+	} else {
+		throw InvalidInputException("Unrecognized option for temp_file_compression \"%s\", expected none or zstd",
+		                            compression);
+	}
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.temp_file_compression) {
+	case TemporaryFileCompression::NONE:
+		return "none";
+	case TemporaryFileCompression::ZSTD:
+		return "zstd";
+	default:
+		throw InternalException("Type not implemented for TemporaryFileCompression");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
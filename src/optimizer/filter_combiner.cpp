@@ -12,6 +12,7 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -568,46 +569,59 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			}
 			auto &fst_const_value_expr = func.children[1]->Cast<BoundConstantExpression>();
 			auto &type = fst_const_value_expr.value.type();
-
-			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
-			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
+			if (type != column_ref.return_type || !InFilter::TypeIsSupported(type)) {
 				continue;
 			}
 
-			bool can_simplify_in_clause = true;
+			vector<Value> constants;
+			bool has_null = false;
 			for (idx_t i = 1; i < func.children.size(); i++) {
 				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
 				if (const_value_expr.value.IsNull()) {
-					can_simplify_in_clause = false;
+					// "x IN (..., NULL)" is never true because of the NULL - we can ignore it in a filter
+					has_null = true;
+					continue;
+				}
+				if (const_value_expr.value.type() != type) {
+					constants.clear();
 					break;
 				}
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				constants.push_back(const_value_expr.value);
 			}
-			if (!can_simplify_in_clause || in_values.empty()) {
+			if (constants.empty()) {
 				continue;
 			}
 
-			sort(in_values.begin(), in_values.end());
-
-			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
-				if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
-					can_simplify_in_clause = false;
-					break;
+			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
+			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
+			bool can_simplify_in_clause = type.IsIntegral() && !has_null;
+			if (can_simplify_in_clause) {
+				for (auto &constant : constants) {
+					in_values.push_back(constant.GetValue<hugeint_t>());
+				}
+				sort(in_values.begin(), in_values.end());
+				for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
+					if (in_values[in_val_idx] - in_values[in_val_idx - 1] > 1) {
+						can_simplify_in_clause = false;
+						break;
+					}
 				}
 			}
-			if (!can_simplify_in_clause) {
-				continue;
+			if (can_simplify_in_clause) {
+				auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+				                                             Value::Numeric(type, in_values.front()));
+				auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
+				                                             Value::Numeric(type, in_values.back()));
+				table_filters.PushFilter(column_index, std::move(lower_bound));
+				table_filters.PushFilter(column_index, std::move(upper_bound));
+			} else {
+				// otherwise push the full IN list into the scan
+				table_filters.PushFilter(column_index, make_uniq<InFilter>(std::move(constants)));
 			}
-			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.front()));
-			auto upper_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO,
-			                                             Value::Numeric(type, in_values.back()));
-			table_filters.PushFilter(column_index, std::move(lower_bound));
-			table_filters.PushFilter(column_index, std::move(upper_bound));
 			table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 
 			remaining_filters.erase_at(rem_fil_idx);
+			rem_fil_idx--;
 		}
 	}
 
@@ -1,8 +1,11 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -16,6 +19,12 @@
 #include <queue>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#define DUCKDB_NUMA_AFFINITY
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -35,33 +44,292 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
-struct ConcurrentQueue {
+//! The tasks that are scheduled by the threads that run on a single NUMA node
+struct NodeTaskQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+	//! The amount of threads of the node that are waiting for the semaphore
+	atomic<idx_t> idle_threads {0};
+	//! The CPUs of the node, empty if the threads are not pinned
+	vector<idx_t> cpus;
+};
+
+struct QueueProducerToken;
+
+//! A task in the deque of a worker thread, together with the producer that scheduled it
+struct WorkerTask {
+	QueueProducerToken *producer;
+	shared_ptr<Task> task;
+};
 
+//! The tasks that were scheduled by a worker thread. The worker runs them itself in LIFO order, as the data they work
+//! on was just produced by the worker and is likely still in its caches. Idle threads steal the oldest tasks.
+struct WorkerTaskDeque {
+	mutex lock;
+	deque<WorkerTask> tasks;
+	//! The amount of tasks in the deque, so idle threads can skip empty deques without taking the lock
+	atomic<idx_t> task_count {0};
+	//! The NUMA node of the worker
+	idx_t node = 0;
+};
+
+struct ConcurrentQueue {
+	ConcurrentQueue(vector<vector<idx_t>> node_cpus, idx_t worker_count);
+
+	//! One queue per NUMA node, or a single queue if NUMA-aware scheduling is disabled
+	vector<unique_ptr<NodeTaskQueue>> nodes;
+	//! The NUMA node of every CPU
+	vector<idx_t> cpu_nodes;
+	//! The deques of the worker threads, workers beyond the amount of deques use the queues of their node
+	vector<unique_ptr<WorkerTaskDeque>> worker_deques;
+
+	idx_t NodeCount() const {
+		return nodes.size();
+	}
+	//! Returns the node of the calling thread
+	idx_t GetCurrentNode() const;
+	//! Returns the deque of the calling thread, or nullptr if it is not a worker thread with a deque
+	WorkerTaskDeque *GetCurrentWorkerDeque();
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeues a task of the given node, or steals a task from the other nodes if there is none
+	bool Dequeue(idx_t node, shared_ptr<Task> &task);
+
+	void EnqueueWorkerTask(WorkerTaskDeque &worker_deque, ProducerToken &token, shared_ptr<Task> task);
+	//! Takes the task that was scheduled last by the worker that owns the deque
+	bool DequeueWorkerTask(WorkerTaskDeque &worker_deque, shared_ptr<Task> &task);
+	//! Steals the oldest task from the deque of a random worker, preferring the workers on the given node
+	bool StealWorkerTask(idx_t node, shared_ptr<Task> &task);
+	//! Removes the tasks of a producer that is destroyed from the deques of the workers
+	void PurgeWorkerTasks(QueueProducerToken &token);
+
+private:
+	void TakeWorkerTask(WorkerTaskDeque &worker_deque, deque<WorkerTask>::iterator entry, shared_ptr<Task> &task);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue) : queue(queue) {
+		queue_tokens.reserve(queue.NodeCount());
+		for (auto &node : queue.nodes) {
+			queue_tokens.emplace_back(node->q);
+		}
+	}
+	~QueueProducerToken() {
+		// the entries of the deques point to the token, so they cannot outlive it
+		queue.PurgeWorkerTasks(*this);
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	ConcurrentQueue &queue;
+	//! The token of the producer for the queue of every node
+	vector<duckdb_moodycamel::ProducerToken> queue_tokens;
+	//! The amount of tasks of the producer that are in the deques of the worker threads
+	atomic<idx_t> worker_task_count {0};
 };
 
+//! The task queue of the scheduler that the running worker thread belongs to, nullptr for other threads
+static thread_local ConcurrentQueue *current_worker_queue = nullptr;
+//! The index of the running worker thread
+static thread_local idx_t current_worker_id = 0;
+//! The NUMA node of the running worker thread
+static thread_local idx_t current_worker_node = 0;
+
+ConcurrentQueue::ConcurrentQueue(vector<vector<idx_t>> node_cpus, idx_t worker_count) {
+	if (node_cpus.empty()) {
+		node_cpus.emplace_back();
+	}
+	for (idx_t node_idx = 0; node_idx < node_cpus.size(); node_idx++) {
+		auto node = make_uniq<NodeTaskQueue>();
+		for (auto &cpu : node_cpus[node_idx]) {
+			if (cpu >= cpu_nodes.size()) {
+				cpu_nodes.resize(cpu + 1, 0);
+			}
+			cpu_nodes[cpu] = node_idx;
+		}
+		node->cpus = std::move(node_cpus[node_idx]);
+		nodes.push_back(std::move(node));
+	}
+	for (idx_t worker_id = 0; worker_id < worker_count; worker_id++) {
+		auto worker_deque = make_uniq<WorkerTaskDeque>();
+		// this matches the node that the scheduler assigns to the worker
+		worker_deque->node = worker_id % nodes.size();
+		worker_deques.push_back(std::move(worker_deque));
+	}
+}
+
+idx_t ConcurrentQueue::GetCurrentNode() const {
+	if (nodes.size() == 1) {
+		return 0;
+	}
+	if (current_worker_queue == this) {
+		return current_worker_node;
+	}
+#ifdef DUCKDB_NUMA_AFFINITY
+	// not one of our workers: use the node of the CPU the thread is currently running on
+	auto cpu = sched_getcpu();
+	if (cpu >= 0 && NumericCast<idx_t>(cpu) < cpu_nodes.size()) {
+		return cpu_nodes[NumericCast<idx_t>(cpu)];
+	}
+#endif
+	return 0;
+}
+
+WorkerTaskDeque *ConcurrentQueue::GetCurrentWorkerDeque() {
+	if (current_worker_queue != this || current_worker_id >= worker_deques.size()) {
+		return nullptr;
+	}
+	return worker_deques[current_worker_id].get();
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
+	auto node = GetCurrentNode();
+	auto &queue = *nodes[node];
+	if (queue.q.enqueue(token.token->queue_tokens[node], std::move(task))) {
+		queue.semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
 	}
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	{
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		auto current_node = GetCurrentNode();
+		for (idx_t i = 0; i < nodes.size(); i++) {
+			auto node = (current_node + i) % nodes.size();
+			if (nodes[node]->q.try_dequeue_from_producer(token.token->queue_tokens[node], task)) {
+				return true;
+			}
+		}
+	}
+	if (token.token->worker_task_count == 0) {
+		return false;
+	}
+	// the producer has tasks in the deques of the workers - take them from there
+	for (auto &worker_deque_ptr : worker_deques) {
+		auto &worker_deque = *worker_deque_ptr;
+		if (worker_deque.task_count == 0) {
+			continue;
+		}
+		lock_guard<mutex> guard(worker_deque.lock);
+		for (auto entry = worker_deque.tasks.begin(); entry != worker_deque.tasks.end(); entry++) {
+			if (entry->producer == token.token.get()) {
+				TakeWorkerTask(worker_deque, entry, task);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(idx_t node, shared_ptr<Task> &task) {
+	if (nodes[node]->q.try_dequeue(task)) {
+		return true;
+	}
+	// the node has no tasks left: steal from the other nodes rather than idling
+	for (idx_t i = 1; i < nodes.size(); i++) {
+		if (nodes[(node + i) % nodes.size()]->q.try_dequeue(task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ConcurrentQueue::EnqueueWorkerTask(WorkerTaskDeque &worker_deque, ProducerToken &token,
+                                       shared_ptr<Task> task) {
+	{
+		lock_guard<mutex> guard(worker_deque.lock);
+		token.token->worker_task_count++;
+		worker_deque.tasks.push_back(WorkerTask {token.token.get(), std::move(task)});
+		worker_deque.task_count = worker_deque.tasks.size();
+	}
+	// the worker runs the task itself once it is done with its current task, unless an idle thread of the node steals
+	// it before that - there is no point in waking up a thread if none of them is idle
+	auto &node = *nodes[worker_deque.node];
+	if (node.idle_threads > 0) {
+		node.semaphore.signal();
+	}
+}
+
+bool ConcurrentQueue::DequeueWorkerTask(WorkerTaskDeque &worker_deque, shared_ptr<Task> &task) {
+	if (worker_deque.task_count == 0) {
+		return false;
+	}
+	lock_guard<mutex> guard(worker_deque.lock);
+	if (worker_deque.tasks.empty()) {
+		return false;
+	}
+	TakeWorkerTask(worker_deque, std::prev(worker_deque.tasks.end()), task);
+	return true;
+}
+
+//! Returns a random number, used to select the worker to steal from so idle threads do not all contend on one deque
+static idx_t NextStealOffset() {
+	// xorshift, seeded per thread
+	static thread_local uint32_t state =
+	    static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+bool ConcurrentQueue::StealWorkerTask(idx_t node, shared_ptr<Task> &task) {
+	auto worker_count = worker_deques.size();
+	if (worker_count == 0) {
+		return false;
+	}
+	auto offset = NextStealOffset();
+	// first try the workers of our own node, then the workers of the other nodes
+	idx_t passes = nodes.size() == 1 ? 1 : 2;
+	for (idx_t pass = 0; pass < passes; pass++) {
+		for (idx_t i = 0; i < worker_count; i++) {
+			auto &worker_deque = *worker_deques[(offset + i) % worker_count];
+			if (worker_deque.task_count == 0 || (passes == 2 && (worker_deque.node == node) != (pass == 0))) {
+				continue;
+			}
+			lock_guard<mutex> guard(worker_deque.lock);
+			if (worker_deque.tasks.empty()) {
+				continue;
+			}
+			TakeWorkerTask(worker_deque, worker_deque.tasks.begin(), task);
+			return true;
+		}
+	}
+	return false;
+}
+
+void ConcurrentQueue::TakeWorkerTask(WorkerTaskDeque &worker_deque, deque<WorkerTask>::iterator entry,
+                                     shared_ptr<Task> &task) {
+	task = std::move(entry->task);
+	entry->producer->worker_task_count--;
+	worker_deque.tasks.erase(entry);
+	worker_deque.task_count = worker_deque.tasks.size();
+}
+
+void ConcurrentQueue::PurgeWorkerTasks(QueueProducerToken &token) {
+	if (token.worker_task_count == 0) {
+		return;
+	}
+	// the tasks are destroyed after the locks are released
+	vector<shared_ptr<Task>> purged_tasks;
+	for (auto &worker_deque_ptr : worker_deques) {
+		auto &worker_deque = *worker_deque_ptr;
+		if (worker_deque.task_count == 0) {
+			continue;
+		}
+		lock_guard<mutex> guard(worker_deque.lock);
+		for (auto entry = worker_deque.tasks.begin(); entry != worker_deque.tasks.end();) {
+			if (entry->producer != &token) {
+				entry++;
+				continue;
+			}
+			purged_tasks.push_back(std::move(entry->task));
+			token.worker_task_count--;
+			entry = worker_deque.tasks.erase(entry);
+		}
+		worker_deque.task_count = worker_deque.tasks.size();
+	}
 }
 
 #else
@@ -94,6 +362,110 @@ struct QueueProducerToken {
 };
 #endif
 
+#ifdef DUCKDB_NUMA_AFFINITY
+static bool ReadSystemFile(FileSystem &fs, const string &path, string &result) {
+	if (!fs.FileExists(path)) {
+		return false;
+	}
+	char byte_buffer[4096];
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	auto read_bytes = fs.Read(*handle, (void *)byte_buffer, sizeof(byte_buffer) - 1);
+	if (read_bytes < 0) {
+		return false;
+	}
+	byte_buffer[read_bytes] = '\0';
+	result = byte_buffer;
+	StringUtil::Trim(result);
+	return true;
+}
+
+//! Parses a list of ranges as used by sysfs, e.g., "0-3,8-11"
+static bool ParseSystemList(const string &list, vector<idx_t> &result) {
+	if (list.empty()) {
+		return true;
+	}
+	for (auto &range : StringUtil::Split(list, ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		if (bounds.empty() || bounds.size() > 2) {
+			return false;
+		}
+		char *end;
+		auto start = std::strtoull(bounds[0].c_str(), &end, 10);
+		if (*end != '\0') {
+			return false;
+		}
+		auto last = start;
+		if (bounds.size() == 2) {
+			last = std::strtoull(bounds[1].c_str(), &end, 10);
+			if (*end != '\0' || last < start) {
+				return false;
+			}
+		}
+		for (auto i = start; i <= last; i++) {
+			result.push_back(i);
+		}
+	}
+	return true;
+}
+
+//! Returns the CPUs of every NUMA node that has CPUs, or nothing if the topology could not be determined
+static vector<vector<idx_t>> GetNumaNodeCPUs(FileSystem &fs) {
+	vector<vector<idx_t>> result;
+	string node_list;
+	vector<idx_t> node_ids;
+	if (!ReadSystemFile(fs, "/sys/devices/system/node/online", node_list) || !ParseSystemList(node_list, node_ids)) {
+		return result;
+	}
+	for (auto &node_id : node_ids) {
+		string cpu_list;
+		vector<idx_t> cpus;
+		auto path = StringUtil::Format("/sys/devices/system/node/node%llu/cpulist", node_id);
+		if (!ReadSystemFile(fs, path, cpu_list) || !ParseSystemList(cpu_list, cpus)) {
+			return vector<vector<idx_t>>();
+		}
+		if (cpus.empty()) {
+			// memory-only node
+			continue;
+		}
+		result.push_back(std::move(cpus));
+	}
+	return result;
+}
+
+static void PinThreadToCPUs(const vector<idx_t> &cpus) {
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// this is best effort: if we are not allowed to run on these CPUs we keep the default affinity
+	pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+}
+#endif
+
+#ifndef DUCKDB_NO_THREADS
+static vector<vector<idx_t>> GetSchedulerNodes(DatabaseInstance &db) {
+	vector<vector<idx_t>> result;
+#ifdef DUCKDB_NUMA_AFFINITY
+	if (db.config.options.numa_aware_scheduling) {
+		result = GetNumaNodeCPUs(FileSystem::GetFileSystem(db));
+	}
+#endif
+	if (result.size() <= 1) {
+		// a single node: use one queue and do not pin the threads
+		result.clear();
+	}
+	return result;
+}
+
+static idx_t GetWorkerDequeCount() {
+	// threads beyond the amount of cores do not benefit from running their own tasks
+	return MaxValue<idx_t>(std::thread::hardware_concurrency(), 1);
+}
+#endif
+
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
     : scheduler(scheduler), token(std::move(token)) {
 }
@@ -102,7 +474,11 @@ ProducerToken::~ProducerToken() {
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
+#ifndef DUCKDB_NO_THREADS
+    : db(db), queue(make_uniq<ConcurrentQueue>(GetSchedulerNodes(db), GetWorkerDequeCount())),
+#else
     : db(db), queue(make_uniq<ConcurrentQueue>()),
+#endif
       allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
       current_thread_count(1) {
 }
@@ -131,6 +507,15 @@ unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+#ifndef DUCKDB_NO_THREADS
+	auto worker_deque = queue->GetCurrentWorkerDeque();
+	if (worker_deque) {
+		// tasks that are scheduled by a worker (e.g., by the events of a pipeline it finished) are placed in its own
+		// deque, so they run on the thread that produced their input unless another thread is idle
+		queue->EnqueueWorkerTask(*worker_deque, token, std::move(task));
+		return;
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
@@ -142,11 +527,26 @@ bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	auto node = queue->GetCurrentNode();
+	auto &semaphore = queue->nodes[node]->semaphore;
+	auto worker_deque = queue->GetCurrentWorkerDeque();
 	// loop until the marker is set to false
 	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
+		// run the tasks that this thread scheduled itself first, these do not need to wait for a signal
+		bool has_task = worker_deque && queue->DequeueWorkerTask(*worker_deque, task);
+		if (!has_task) {
+			auto &idle_threads = queue->nodes[node]->idle_threads;
+			idle_threads++;
+			if (queue->NodeCount() == 1) {
+				semaphore.wait();
+			} else {
+				// tasks that are scheduled on other nodes do not signal us: wait with a timeout so we can steal them
+				semaphore.wait(TASK_TIMEOUT_USECS);
+			}
+			idle_threads--;
+			has_task = queue->Dequeue(node, task) || queue->StealWorkerTask(node, task);
+		}
+		if (has_task) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -174,10 +574,11 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	auto node = queue->GetCurrentNode();
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(node, task) && !queue->StealWorkerTask(node, task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -205,9 +606,10 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	auto node = queue->GetCurrentNode();
 	for (idx_t i = 0; i < max_tasks; i++) {
-		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		queue->nodes[node]->semaphore.wait(TASK_TIMEOUT_USECS);
+		if (!queue->Dequeue(node, task) && !queue->StealWorkerTask(node, task)) {
 			return;
 		}
 		try {
@@ -234,7 +636,18 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, ConcurrentQueue *queue, atomic<bool> *marker,
+                               idx_t worker_id, idx_t node) {
+	current_worker_queue = queue;
+	current_worker_id = worker_id;
+	current_worker_node = node;
+	auto cpus = &queue->nodes[node]->cpus;
+#ifdef DUCKDB_NUMA_AFFINITY
+	if (!cpus->empty()) {
+		// pin the thread before it allocates anything, so its thread-local memory is placed on its own node
+		PinThreadToCPUs(*cpus);
+	}
+#endif
 	scheduler->ExecuteForever(marker);
 }
 #endif
@@ -266,7 +679,9 @@ void TaskScheduler::SetAllocatorFlushTreshold(idx_t threshold) {
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
-	queue->semaphore.signal(NumericCast<ssize_t>(n));
+	for (auto &node : queue->nodes) {
+		node->semaphore.signal(NumericCast<ssize_t>(n));
+	}
 #endif
 }
 
@@ -310,9 +725,12 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			// spread the threads over the NUMA nodes
+			auto worker_id = threads.size();
+			auto node = worker_id % queue->NodeCount();
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, queue.get(), marker.get(), worker_id, node);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
@@ -2,6 +2,7 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,7 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->sort_key = sort_key;
 	return std::move(result);
 }
 
@@ -46,10 +48,18 @@ string CreateTableInfo::ToString() const {
 	}
 	ret += QualifierToString(temporary ? "" : catalog, schema, table);
 
+	string options;
+	if (!sort_key.empty()) {
+		vector<string> quoted_columns;
+		for (auto &column : sort_key) {
+			quoted_columns.push_back(KeywordHelper::WriteOptionallyQuoted(column));
+		}
+		options = " WITH (sort_key = " + KeywordHelper::WriteQuoted(StringUtil::Join(quoted_columns, ", "), '\'') + ")";
+	}
 	if (query != nullptr) {
-		ret += " AS " + query->ToString();
+		ret += options + " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + options + ";";
 	}
 	return ret;
 }
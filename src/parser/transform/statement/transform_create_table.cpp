@@ -4,6 +4,7 @@
 #include "duckdb/parser/constraint.hpp"
 #include "duckdb/parser/expression/collate_expression.hpp"
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
+#include "duckdb/common/string_util.hpp"
 
 namespace duckdb {
 
@@ -66,6 +67,47 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+void Transformer::TransformTableOptions(optional_ptr<duckdb_libpgquery::PGList> options, CreateTableInfo &info) {
+	if (!options) {
+		return;
+	}
+	for (auto cell = options->head; cell != nullptr; cell = lnext(cell)) {
+		auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+		auto option_name = StringUtil::Lower(def_elem->defname);
+		if (option_name != "sort_key") {
+			throw ParserException("Unrecognized option \"%s\" for CREATE TABLE", def_elem->defname);
+		}
+		if (!def_elem->arg) {
+			throw ParserException("Option \"sort_key\" requires a column name or a list of column names");
+		}
+		vector<string> sort_key;
+		switch (def_elem->arg->type) {
+		case duckdb_libpgquery::T_PGString: {
+			// sort_key = 'a, "b"'
+			auto value = PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+			sort_key = StringUtil::SplitWithQuote(value->val.str, ',', '"');
+			break;
+		}
+		case duckdb_libpgquery::T_PGTypeName: {
+			// sort_key = a
+			auto type_name = PGPointerCast<duckdb_libpgquery::PGTypeName>(def_elem->arg);
+			if (type_name->names->length != 1 || type_name->typmods || type_name->arrayBounds) {
+				throw ParserException("Option \"sort_key\" expects a column name");
+			}
+			auto value = PGPointerCast<duckdb_libpgquery::PGValue>(type_name->names->head->data.ptr_value);
+			sort_key.emplace_back(value->val.str);
+			break;
+		}
+		default:
+			throw ParserException("Option \"sort_key\" requires a column name or a list of column names");
+		}
+		if (sort_key.empty()) {
+			throw ParserException("Option \"sort_key\" requires at least one column");
+		}
+		info.sort_key = std::move(sort_key);
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -123,6 +165,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 	if (!column_count) {
 		throw ParserException("Table must have at least one column!");
 	}
+	TransformTableOptions(stmt.options, *info);
 
 	result->info = std::move(info);
 	return result;
@@ -8,7 +8,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTableAs(duckdb_libpgquer
 	if (stmt.relkind == duckdb_libpgquery::PG_OBJECT_MATVIEW) {
 		throw NotImplementedException("Materialized view not implemented");
 	}
-	if (stmt.is_select_into || stmt.into->colNames || stmt.into->options) {
+	if (stmt.is_select_into || stmt.into->colNames) {
 		throw NotImplementedException("Unimplemented features for CREATE TABLE as");
 	}
 	auto qname = TransformQualifiedName(*stmt.into->rel);
@@ -26,6 +26,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTableAs(duckdb_libpgquer
 	info->temporary =
 	    stmt.into->rel->relpersistence == duckdb_libpgquery::PGPostgresRelPersistence::PG_RELPERSISTENCE_TEMP;
 	info->query = std::move(query);
+	TransformTableOptions(stmt.into->options, *info);
 	result->info = std::move(info);
 	return result;
 }
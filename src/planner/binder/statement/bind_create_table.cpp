@@ -338,6 +338,17 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 		}
 		BindLogicalType(context, column.TypeMutable(), &result->schema.catalog);
 	}
+	// verify that the sort key refers to physical columns of the table
+	for (auto &sort_column : base.sort_key) {
+		if (!base.columns.ColumnExists(sort_column)) {
+			throw BinderException("Sort key column \"%s\" does not exist in table \"%s\"", sort_column, base.table);
+		}
+		auto &column = base.columns.GetColumn(sort_column);
+		if (column.Generated()) {
+			throw BinderException("Sort key column \"%s\" cannot be a generated column", sort_column);
+		}
+		sort_column = column.Name();
+	}
 	result->dependencies.VerifyDependencies(schema.catalog, result->Base().table);
 
 	auto &properties = GetStatementProperties();
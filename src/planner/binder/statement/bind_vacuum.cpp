@@ -5,6 +5,7 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_vacuum.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
@@ -21,6 +22,12 @@ void Binder::BindVacuumTable(LogicalVacuum &vacuum, unique_ptr<LogicalOperator>
 	}
 	auto ref = unique_ptr_cast<BoundTableRef, BoundBaseTableRef>(std::move(bound_table));
 	auto &table = ref->table;
+	if (info.options.vacuum && table.IsDuckTable() && table.GetStorage().HasIndexes()) {
+		// the deleted rows of a table can only be compacted if no index refers to their row ids
+		throw NotImplementedException("VACUUM cannot compact table \"%s\" because it has indexes - use ANALYZE to "
+		                              "only update its statistics",
+		                              table.name);
+	}
 	vacuum.SetTable(table);
 
 	vector<unique_ptr<Expression>> select_list;
@@ -5,7 +5,7 @@ namespace duckdb {
 ConjunctionOrFilter::ConjunctionOrFilter() : ConjunctionFilter(TableFilterType::CONJUNCTION_OR) {
 }
 
-FilterPropagateResult ConjunctionOrFilter::CheckStatistics(BaseStatistics &stats) {
+FilterPropagateResult ConjunctionOrFilter::CheckStatistics(BaseStatistics &stats) const {
 	// the OR filter is true if ANY of the children is true
 	D_ASSERT(!child_filters.empty());
 	for (auto &filter : child_filters) {
@@ -19,6 +19,16 @@ FilterPropagateResult ConjunctionOrFilter::CheckStatistics(BaseStatistics &stats
 	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
 }
 
+bool ConjunctionOrFilter::CheckBloomFilter(const BloomFilter &bloom_filter) {
+	// the OR filter can only be satisfied if ANY of the children can be satisfied
+	for (auto &filter : child_filters) {
+		if (filter->CheckBloomFilter(bloom_filter)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 string ConjunctionOrFilter::ToString(const string &column_name) {
 	string result;
 	for (idx_t i = 0; i < child_filters.size(); i++) {
@@ -30,6 +40,14 @@ string ConjunctionOrFilter::ToString(const string &column_name) {
 	return result;
 }
 
+unique_ptr<TableFilter> ConjunctionOrFilter::Copy() const {
+	auto result = make_uniq<ConjunctionOrFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 bool ConjunctionOrFilter::Equals(const TableFilter &other_p) const {
 	if (!ConjunctionFilter::Equals(other_p)) {
 		return false;
@@ -49,7 +67,7 @@ bool ConjunctionOrFilter::Equals(const TableFilter &other_p) const {
 ConjunctionAndFilter::ConjunctionAndFilter() : ConjunctionFilter(TableFilterType::CONJUNCTION_AND) {
 }
 
-FilterPropagateResult ConjunctionAndFilter::CheckStatistics(BaseStatistics &stats) {
+FilterPropagateResult ConjunctionAndFilter::CheckStatistics(BaseStatistics &stats) const {
 	// the AND filter is true if ALL of the children is true
 	D_ASSERT(!child_filters.empty());
 	auto result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
@@ -64,6 +82,16 @@ FilterPropagateResult ConjunctionAndFilter::CheckStatistics(BaseStatistics &stat
 	return result;
 }
 
+bool ConjunctionAndFilter::CheckBloomFilter(const BloomFilter &bloom_filter) {
+	// the AND filter can only be satisfied if ALL of the children can be satisfied
+	for (auto &filter : child_filters) {
+		if (!filter->CheckBloomFilter(bloom_filter)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 string ConjunctionAndFilter::ToString(const string &column_name) {
 	string result;
 	for (idx_t i = 0; i < child_filters.size(); i++) {
@@ -75,6 +103,14 @@ string ConjunctionAndFilter::ToString(const string &column_name) {
 	return result;
 }
 
+unique_ptr<TableFilter> ConjunctionAndFilter::Copy() const {
+	auto result = make_uniq<ConjunctionAndFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 bool ConjunctionAndFilter::Equals(const TableFilter &other_p) const {
 	if (!ConjunctionFilter::Equals(other_p)) {
 		return false;
@@ -1,5 +1,6 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -8,7 +9,7 @@ ConstantFilter::ConstantFilter(ExpressionType comparison_type_p, Value constant_
       constant(std::move(constant_p)) {
 }
 
-FilterPropagateResult ConstantFilter::CheckStatistics(BaseStatistics &stats) {
+FilterPropagateResult ConstantFilter::CheckStatistics(BaseStatistics &stats) const {
 	D_ASSERT(constant.type().id() == stats.GetType().id());
 	switch (constant.type().InternalType()) {
 	case PhysicalType::UINT8:
@@ -31,10 +32,21 @@ FilterPropagateResult ConstantFilter::CheckStatistics(BaseStatistics &stats) {
 	}
 }
 
+bool ConstantFilter::CheckBloomFilter(const BloomFilter &bloom_filter) {
+	if (comparison_type != ExpressionType::COMPARE_EQUAL || constant.IsNull()) {
+		return true;
+	}
+	return bloom_filter.MayContain(constant.Hash());
+}
+
 string ConstantFilter::ToString(const string &column_name) {
 	return column_name + ExpressionTypeToOperator(comparison_type) + constant.ToSQLString();
 }
 
+unique_ptr<TableFilter> ConstantFilter::Copy() const {
+	return make_uniq<ConstantFilter>(comparison_type, constant);
+}
+
 bool ConstantFilter::Equals(const TableFilter &other_p) const {
 	if (!TableFilter::Equals(other_p)) {
 		return false;
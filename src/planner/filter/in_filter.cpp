@@ -0,0 +1,107 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/common/algorithm.hpp"
+
+namespace duckdb {
+
+static vector<Value> PrepareInFilterValues(vector<Value> values) {
+	D_ASSERT(!values.empty());
+	values.erase(std::remove_if(values.begin(), values.end(), [](const Value &value) { return value.IsNull(); }),
+	             values.end());
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+	return values;
+}
+
+InFilter::InFilter(vector<Value> values_p)
+    : TableFilter(TableFilterType::IN_FILTER), values(PrepareInFilterValues(std::move(values_p))),
+      sorted_values(values.empty() ? LogicalType::SQLNULL : values[0].type(), MaxValue<idx_t>(values.size(), 1)) {
+	for (idx_t i = 0; i < values.size(); i++) {
+		D_ASSERT(values[i].type() == values[0].type());
+		sorted_values.SetValue(i, values[i]);
+	}
+}
+
+bool InFilter::TypeIsSupported(const LogicalType &type) {
+	auto physical_type = type.InternalType();
+	return TypeIsNumeric(physical_type) || physical_type == PhysicalType::VARCHAR || physical_type == PhysicalType::BOOL;
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) const {
+	if (values.empty()) {
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE: {
+		if (!NumericStats::HasMinMax(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		// find the smallest constant >= min, the filter can only be true if that constant is <= max
+		auto min = NumericStats::Min(stats);
+		auto max = NumericStats::Max(stats);
+		auto entry = std::lower_bound(values.begin(), values.end(), min);
+		if (entry == values.end() || max < *entry) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case PhysicalType::VARCHAR:
+		// the string min/max are truncated prefixes: check the constants one-by-one
+		for (auto &value : values) {
+			auto prune_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+bool InFilter::CheckBloomFilter(const BloomFilter &bloom_filter) {
+	for (auto &value : values) {
+		if (bloom_filter.MayContain(value.Hash())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string result = column_name + " IN (";
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		result += values[i].ToSQLString();
+	}
+	return result + ")";
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (other_p.filter_type != filter_type) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+} // namespace duckdb
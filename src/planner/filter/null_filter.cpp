@@ -6,7 +6,7 @@ namespace duckdb {
 IsNullFilter::IsNullFilter() : TableFilter(TableFilterType::IS_NULL) {
 }
 
-FilterPropagateResult IsNullFilter::CheckStatistics(BaseStatistics &stats) {
+FilterPropagateResult IsNullFilter::CheckStatistics(BaseStatistics &stats) const {
 	if (!stats.CanHaveNull()) {
 		// no null values are possible: always false
 		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
@@ -22,10 +22,14 @@ string IsNullFilter::ToString(const string &column_name) {
 	return column_name + "IS NULL";
 }
 
+unique_ptr<TableFilter> IsNullFilter::Copy() const {
+	return make_uniq<IsNullFilter>();
+}
+
 IsNotNullFilter::IsNotNullFilter() : TableFilter(TableFilterType::IS_NOT_NULL) {
 }
 
-FilterPropagateResult IsNotNullFilter::CheckStatistics(BaseStatistics &stats) {
+FilterPropagateResult IsNotNullFilter::CheckStatistics(BaseStatistics &stats) const {
 	if (!stats.CanHaveNoNull()) {
 		// no non-null values are possible: always false
 		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
@@ -41,4 +45,8 @@ string IsNotNullFilter::ToString(const string &column_name) {
 	return column_name + " IS NOT NULL";
 }
 
+unique_ptr<TableFilter> IsNotNullFilter::Copy() const {
+	return make_uniq<IsNotNullFilter>();
+}
+
 } // namespace duckdb
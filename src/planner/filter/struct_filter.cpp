@@ -10,7 +10,7 @@ StructFilter::StructFilter(idx_t child_idx_p, string child_name_p, unique_ptr<Ta
       child_filter(std::move(child_filter_p)) {
 }
 
-FilterPropagateResult StructFilter::CheckStatistics(BaseStatistics &stats) {
+FilterPropagateResult StructFilter::CheckStatistics(BaseStatistics &stats) const {
 	D_ASSERT(stats.GetType().id() == LogicalTypeId::STRUCT);
 	// Check the child statistics
 	auto &child_stats = StructStats::GetChildStats(stats, child_idx);
@@ -21,6 +21,10 @@ string StructFilter::ToString(const string &column_name) {
 	return child_filter->ToString(column_name + "." + child_name);
 }
 
+unique_ptr<TableFilter> StructFilter::Copy() const {
+	return make_uniq<StructFilter>(child_idx, child_name, child_filter->Copy());
+}
+
 bool StructFilter::Equals(const TableFilter &other_p) const {
 	if (!TableFilter::Equals(other_p)) {
 		return false;
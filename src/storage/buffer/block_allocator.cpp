@@ -0,0 +1,250 @@
+#include "duckdb/storage/buffer/block_allocator.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+
+#include <cstring>
+
+#ifndef _WIN32
+// sys/mman.h defines MAP_TYPE, which clashes with template parameters in other files of the unity build
+#pragma push_macro("MAP_TYPE")
+#include <sys/mman.h>
+#pragma pop_macro("MAP_TYPE")
+#endif
+
+namespace duckdb {
+
+struct BlockAllocatorData : public PrivateAllocatorData {
+	explicit BlockAllocatorData(BlockAllocator &block_allocator) : block_allocator(block_allocator) {
+	}
+
+	BlockAllocator &block_allocator;
+};
+
+static data_ptr_t BlockAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size) {
+	auto &block_allocator = private_data->Cast<BlockAllocatorData>().block_allocator;
+	if (size == block_allocator.GetBlockSize()) {
+		auto result = block_allocator.AllocateBlock();
+		if (result) {
+			return result;
+		}
+		block_allocator.CountFallbackAllocation();
+	}
+	return Allocator::DefaultAllocator().AllocateData(size);
+}
+
+static void BlockAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+	auto &block_allocator = private_data->Cast<BlockAllocatorData>().block_allocator;
+	if (block_allocator.FreeBlock(pointer)) {
+		return;
+	}
+	Allocator::DefaultAllocator().FreeData(pointer, size);
+}
+
+static data_ptr_t BlockAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
+                                        idx_t size) {
+	auto &block_allocator = private_data->Cast<BlockAllocatorData>().block_allocator;
+	if (size != block_allocator.GetBlockSize() && !block_allocator.IsBlock(pointer)) {
+		// neither the old nor the new allocation is a block
+		return Allocator::DefaultAllocator().ReallocateData(pointer, old_size, size);
+	}
+	auto result = BlockAllocatorAllocate(private_data, size);
+	memcpy(result, pointer, MinValue<idx_t>(old_size, size));
+	BlockAllocatorFree(private_data, pointer, old_size);
+	return result;
+}
+
+//! Map a region of anonymous memory that is aligned to the huge page size, returns nullptr if this is not possible
+static data_ptr_t MapRegion(idx_t size, bool &huge_pages) {
+#ifndef _WIN32
+	const auto alignment = BlockAllocator::HUGE_PAGE_SIZE;
+	auto allocation = mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (allocation == MAP_FAILED) {
+		return nullptr;
+	}
+	// trim the memory before and after the aligned region
+	auto start = reinterpret_cast<uintptr_t>(allocation);
+	auto aligned_start = (start + alignment - 1) & ~(alignment - 1);
+	auto end = start + size + alignment;
+	auto aligned_end = aligned_start + size;
+	if (aligned_start > start) {
+		munmap(allocation, aligned_start - start);
+	}
+	if (end > aligned_end) {
+		munmap(reinterpret_cast<void *>(aligned_end), end - aligned_end);
+	}
+	auto result = reinterpret_cast<data_ptr_t>(aligned_start);
+#ifdef MADV_HUGEPAGE
+	huge_pages = madvise(result, size, MADV_HUGEPAGE) == 0;
+#else
+	huge_pages = false;
+#endif
+	return result;
+#else
+	// FIXME: use VirtualAlloc with MEM_LARGE_PAGES, this requires the SeLockMemoryPrivilege
+	huge_pages = false;
+	return nullptr;
+#endif
+}
+
+static void UnmapRegion(data_ptr_t base, idx_t size) {
+#ifndef _WIN32
+	munmap(base, size);
+#endif
+}
+
+BlockAllocator::BlockAllocator(idx_t block_size_p)
+    : block_size(block_size_p), blocks_per_region(REGION_SIZE / block_size_p),
+      allocator(BlockAllocatorAllocate, BlockAllocatorFree, BlockAllocatorRealloc,
+                make_uniq<BlockAllocatorData>(*this)),
+      enabled(false), huge_pages(false), empty_region(nullptr), allocations(0), recycled_allocations(0),
+      fallback_allocations(0) {
+	D_ASSERT(blocks_per_region > 0);
+}
+
+BlockAllocator::~BlockAllocator() {
+	for (auto &entry : regions) {
+		UnmapRegion(entry.first, REGION_SIZE);
+	}
+}
+
+Allocator &BlockAllocator::GetAllocator() {
+	return allocator;
+}
+
+void BlockAllocator::SetEnabled(bool enabled_p) {
+	enabled = enabled_p;
+}
+
+bool BlockAllocator::IsEnabled() const {
+	return enabled;
+}
+
+BlockAllocator::BlockRegion *BlockAllocator::GetRegion(data_ptr_t pointer) {
+	// find the region with the highest start address that is not higher than the pointer
+	auto entry = regions.upper_bound(pointer);
+	if (entry == regions.begin()) {
+		return nullptr;
+	}
+	--entry;
+	if (pointer >= entry->first + REGION_SIZE) {
+		return nullptr;
+	}
+	return entry->second.get();
+}
+
+BlockAllocator::BlockRegion *BlockAllocator::CreateRegion() {
+	bool region_huge_pages;
+	auto base = MapRegion(REGION_SIZE, region_huge_pages);
+	if (!base) {
+		return nullptr;
+	}
+	huge_pages = region_huge_pages;
+
+	auto region = make_uniq<BlockRegion>();
+	region->base = base;
+	region->used_blocks = 0;
+	region->initialized_blocks = 0;
+	auto &result = *region;
+	regions[base] = std::move(region);
+	available_regions.insert(base);
+	return &result;
+}
+
+void BlockAllocator::DestroyRegion(BlockRegion &region) {
+	D_ASSERT(region.used_blocks == 0);
+	auto base = region.base;
+	available_regions.erase(base);
+	regions.erase(base);
+	UnmapRegion(base, REGION_SIZE);
+}
+
+data_ptr_t BlockAllocator::AllocateBlock() {
+	lock_guard<mutex> guard(lock);
+	BlockRegion *region;
+	if (available_regions.empty()) {
+		region = CreateRegion();
+		if (!region) {
+			return nullptr;
+		}
+	} else {
+		region = regions[*available_regions.begin()].get();
+	}
+
+	idx_t block_index;
+	if (!region->free_list.empty()) {
+		// recycle a freed block
+		block_index = region->free_list.back();
+		region->free_list.pop_back();
+		recycled_allocations++;
+	} else {
+		D_ASSERT(region->initialized_blocks < blocks_per_region);
+		block_index = region->initialized_blocks++;
+	}
+	allocations++;
+
+	if (region->base == empty_region) {
+		empty_region = nullptr;
+	}
+	region->used_blocks++;
+	if (region->used_blocks == blocks_per_region) {
+		available_regions.erase(region->base);
+	}
+	return region->base + block_index * block_size;
+}
+
+bool BlockAllocator::IsBlock(data_ptr_t pointer) {
+	lock_guard<mutex> guard(lock);
+	return GetRegion(pointer) != nullptr;
+}
+
+bool BlockAllocator::FreeBlock(data_ptr_t pointer) {
+	lock_guard<mutex> guard(lock);
+	auto region = GetRegion(pointer);
+	if (!region) {
+		return false;
+	}
+	auto offset = NumericCast<idx_t>(pointer - region->base);
+	D_ASSERT(offset % block_size == 0);
+	D_ASSERT(region->used_blocks > 0);
+	region->free_list.push_back(NumericCast<uint32_t>(offset / block_size));
+
+	if (region->used_blocks == blocks_per_region) {
+		available_regions.insert(region->base);
+	}
+	region->used_blocks--;
+	if (region->used_blocks == 0) {
+		// the region is empty: keep one empty region around, and return the others to the operating system
+		if (!empty_region) {
+			empty_region = region->base;
+		} else {
+			DestroyRegion(*region);
+		}
+	}
+	return true;
+}
+
+void BlockAllocator::CountFallbackAllocation() {
+	fallback_allocations++;
+}
+
+BlockAllocatorInformation BlockAllocator::GetInformation() {
+	lock_guard<mutex> guard(lock);
+	BlockAllocatorInformation result;
+	result.enabled = enabled;
+	result.huge_pages = huge_pages;
+	result.block_size = block_size;
+	result.region_count = regions.size();
+	result.reserved_memory = regions.size() * REGION_SIZE;
+	result.used_blocks = 0;
+	for (auto &entry : regions) {
+		result.used_blocks += entry.second->used_blocks;
+	}
+	result.free_blocks = regions.size() * blocks_per_region - result.used_blocks;
+	result.allocations = allocations;
+	result.recycled_allocations = recycled_allocations;
+	result.fallback_allocations = fallback_allocations;
+	return result;
+}
+
+} // namespace duckdb
@@ -9,9 +9,12 @@
 namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
-    : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_seq_num(0),
+    : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag),
+      memory_mapped(block_id_p < MAXIMUM_BLOCK && block_manager.IsMemoryMapped()), buffer(nullptr), eviction_seq_num(0),
       can_destroy(false), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	eviction_seq_num = 0;
+	eviction_queue_idx = 0;
+	access_count = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
 }
@@ -19,9 +22,11 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag,
                          unique_ptr<FileBuffer> buffer_p, bool can_destroy_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
-    : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0),
-      can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
+    : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), memory_mapped(false),
+      eviction_seq_num(0), can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
       unswizzled(nullptr) {
+	eviction_queue_idx = 0;
+	access_count = 0;
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -31,15 +36,15 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	// being destroyed, so any unswizzled pointers are just binary junk now.
 	unswizzled = nullptr;
-	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
+	if (buffer && buffer->type != FileBufferType::TINY_BUFFER && !memory_mapped) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes();
+		buffer_manager.GetBufferPool().IncrementDeadNodes(*this);
 	}
 
 	// no references remain to this block: erase
 	if (buffer && state == BlockState::BLOCK_LOADED) {
-		D_ASSERT(memory_charge.size > 0);
+		D_ASSERT(memory_charge.size > 0 || memory_mapped);
 		// the block is still loaded in memory: erase it
 		buffer.reset();
 		memory_charge.Resize(0);
@@ -77,7 +82,10 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	}
 
 	auto &block_manager = handle->block_manager;
-	if (handle->block_id < MAXIMUM_BLOCK) {
+	if (handle->memory_mapped) {
+		// the block is a view into the mapped file: there is nothing to read
+		handle->buffer = block_manager.MapBlock(handle->block_id);
+	} else if (handle->block_id < MAXIMUM_BLOCK) {
 		auto block = AllocateBlock(block_manager, std::move(reusable_buffer), handle->block_id);
 		block_manager.Read(*block);
 		handle->buffer = std::move(block);
@@ -93,6 +101,18 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	return BufferHandle(handle, handle->buffer.get());
 }
 
+BufferHandle BlockHandle::LoadFromBuffer(shared_ptr<BlockHandle> &handle, data_ptr_t data,
+                                         unique_ptr<FileBuffer> reusable_buffer) {
+	D_ASSERT(handle->state != BlockState::BLOCK_LOADED);
+	D_ASSERT(handle->block_id < MAXIMUM_BLOCK);
+	// copy the contents of the block (including its header) into a new block
+	auto block = AllocateBlock(handle->block_manager, std::move(reusable_buffer), handle->block_id);
+	memcpy(block->InternalBuffer(), data, block->AllocSize());
+	handle->buffer = std::move(block);
+	handle->state = BlockState::BLOCK_LOADED;
+	return BufferHandle(handle, handle->buffer.get());
+}
+
 unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	if (state == BlockState::BLOCK_UNLOADED) {
 		// already unloaded: nothing to do
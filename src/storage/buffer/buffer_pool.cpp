@@ -2,15 +2,68 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
+public:
+	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0) {
+	}
+
+public:
+	//! Add a node to the queue. Returns true, if the queue is ready to be purged, and false otherwise.
+	bool AddToEvictionQueue(BufferEvictionNode &&node);
+	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
+	bool TryDequeueWithLock(BufferEvictionNode &node);
+	//! Garbage collect dead nodes in the eviction queue.
+	void Purge();
+	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
+	void PurgeIteration(const idx_t purge_size);
+
+	//! Increment the dead node counter in the purge queue.
+	inline void IncrementDeadNodes() {
+		total_dead_nodes++;
+	}
+	//! Decrement the dead node counter in the purge queue.
+	inline void DecrementDeadNodes() {
+		total_dead_nodes--;
+	}
+
+public:
+	//! The concurrent queue
 	eviction_queue_t q;
+
+private:
+	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
+	constexpr static idx_t INSERT_INTERVAL = 4096;
+	//! We multiply the base purge size by this value.
+	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
+	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
+	//! We never purge below this point.
+	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
+	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
+	//! exceed their allowed ratio. Must be greater than 1.
+	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
+
+	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
+	atomic<idx_t> evict_queue_insertions;
+	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into an eviction queue.
+	atomic<idx_t> total_dead_nodes;
+	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
+	//! Only lets a single thread enter the purge phase.
+	mutex purge_lock;
+
+	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
+	vector<BufferEvictionNode> purge_nodes;
 };
 
 BufferEvictionNode::BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t eviction_seq_num)
@@ -40,15 +93,47 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 	return handle_p;
 }
 
-BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
+BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, EvictionPolicyType eviction_policy_type,
+                       bool use_block_allocator)
     : current_memory(0), maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      queue(make_uniq<EvictionQueue>()), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()),
-      evict_queue_insertions(0), total_dead_nodes(0) {
+      eviction_policy(nullptr), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()),
+      block_allocator(make_uniq<BlockAllocator>(Storage::BLOCK_ALLOC_SIZE)), background_eviction_low_watermark(0.8),
+      background_eviction_high_watermark(0.9), background_eviction_threshold(NumericLimits<idx_t>::Maximum()),
+      background_eviction_requested(false), reservation_count(0), inline_eviction_count(0),
+      inline_evicted_block_count(0), background_eviction_count(0), background_evicted_block_count(0) {
+	block_allocator->SetEnabled(use_block_allocator);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
 	}
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		queues.push_back(make_uniq<EvictionQueue>());
+	}
+	SetEvictionPolicy(EvictionPolicy::Create(eviction_policy_type));
 }
 BufferPool::~BufferPool() {
+	SetBackgroundEviction(false);
+}
+
+static idx_t GetEvictionQueueIndex(EvictionPriority priority, EvictionSegment segment) {
+	// the queues of the lowest priority are evicted first, and within a priority the probationary queue goes first
+	auto index = static_cast<idx_t>(priority) * 2 + static_cast<idx_t>(segment);
+	D_ASSERT(index < BufferPool::EVICTION_QUEUE_COUNT);
+	return index;
+}
+
+static bool IsProtectedQueue(idx_t queue_idx) {
+	return queue_idx % 2 == static_cast<idx_t>(EvictionSegment::PROTECTED);
+}
+
+void BufferPool::SetEvictionPolicy(unique_ptr<EvictionPolicy> policy) {
+	lock_guard<mutex> l_lock(limit_lock);
+	eviction_policy = policy.get();
+	eviction_policies.push_back(std::move(policy));
+}
+
+bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
+	q.enqueue(std::move(node));
+	return ++evict_queue_insertions % INSERT_INTERVAL == 0;
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
@@ -65,18 +150,21 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 		        .count();
 	}
 
-	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
-
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
 	}
 
-	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
-		return true;
-	}
-	return false;
+	auto &policy = *eviction_policy.load();
+	auto queue_idx = GetEvictionQueueIndex(policy.GetPriority(handle->tag), policy.GetSegment(handle->access_count));
+	handle->eviction_queue_idx = queue_idx;
+
+	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
+	return queues[queue_idx]->AddToEvictionQueue(std::move(evict_node));
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -84,8 +172,11 @@ void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
 		current_memory -= UnsafeNumericCast<idx_t>(-size);
 		memory_usage_per_tag[uint8_t(tag)] -= UnsafeNumericCast<idx_t>(-size);
 	} else {
-		current_memory += UnsafeNumericCast<idx_t>(size);
+		auto new_memory = current_memory += UnsafeNumericCast<idx_t>(size);
 		memory_usage_per_tag[uint8_t(tag)] += UnsafeNumericCast<idx_t>(size);
+		if (new_memory > background_eviction_threshold && !background_eviction_requested.exchange(true)) {
+			RequestBackgroundEviction();
+		}
 	}
 }
 
@@ -105,35 +196,45 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+BlockAllocator &BufferPool::GetBlockAllocator() {
+	return *block_allocator;
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
 	TempBufferPoolReservation r(tag, *this, extra_memory);
 	bool found = false;
+	reservation_count++;
 
 	if (current_memory <= memory_limit) {
 		return {true, std::move(r)};
 	}
 
-	IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
-		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
-			// we can re-use the memory directly
-			*buffer = handle->UnloadAndTakeBlock();
-			found = true;
-			return false;
-		}
+	// the memory limit is reached: this thread has to evict blocks itself
+	inline_eviction_count++;
+	for (idx_t queue_idx = 0; queue_idx < queues.size() && !found; queue_idx++) {
+		IterateUnloadableBlocks(queue_idx, [&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+			// hooray, we can unload the block
+			inline_evicted_block_count++;
+			if (buffer && handle->buffer->AllocSize() == extra_memory) {
+				// we can re-use the memory directly
+				*buffer = handle->UnloadAndTakeBlock();
+				found = true;
+				return false;
+			}
 
-		// release the memory and mark the block as unloaded
-		handle->Unload();
+			// release the memory and mark the block as unloaded
+			handle->Unload();
 
-		if (current_memory <= memory_limit) {
-			found = true;
-			return false;
-		}
+			if (current_memory <= memory_limit) {
+				found = true;
+				return false;
+			}
 
-		// Continue iteration
-		return true;
-	});
+			// Continue iteration
+			return true;
+		});
+	}
 
 	if (!found) {
 		r.Resize(0);
@@ -148,26 +249,29 @@ idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 	                  .count();
 	int64_t limit = now - (static_cast<int64_t>(max_age_sec) * 1000);
 	idx_t purged_bytes = 0;
-	IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
-		// We will unload this block regardless. But stop the iteration immediately afterward if this
-		// block is younger than the age threshold.
-		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
-		purged_bytes += handle->GetMemoryUsage();
-		handle->Unload();
-		return is_fresh;
-	});
+	for (idx_t queue_idx = 0; queue_idx < queues.size(); queue_idx++) {
+		IterateUnloadableBlocks(queue_idx, [&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
+			// We will unload this block regardless. But stop the iteration immediately afterward if this
+			// block is younger than the age threshold.
+			bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
+			purged_bytes += handle->GetMemoryUsage();
+			handle->Unload();
+			return is_fresh;
+		});
+	}
 	return purged_bytes;
 }
 
 template <typename FN>
-void BufferPool::IterateUnloadableBlocks(FN fn) {
+void BufferPool::IterateUnloadableBlocks(idx_t queue_idx, FN fn) {
+	auto &queue = *queues[queue_idx];
 	for (;;) {
 		// get a block to unpin from the queue
 		BufferEvictionNode node;
-		if (!queue->q.try_dequeue(node)) {
+		if (!queue.q.try_dequeue(node)) {
 			// we could not dequeue any eviction node, so we try one more time,
 			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
+			if (!queue.TryDequeueWithLock(node)) {
 				return;
 			}
 		}
@@ -175,7 +279,7 @@ void BufferPool::IterateUnloadableBlocks(FN fn) {
 		// get a reference to the underlying block pointer
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
-			DecrementDeadNodes();
+			queue.DecrementDeadNodes();
 			continue;
 		}
 
@@ -183,22 +287,26 @@ void BufferPool::IterateUnloadableBlocks(FN fn) {
 		lock_guard<mutex> lock(handle->lock);
 		if (!node.CanUnload(*handle)) {
 			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
+			queue.DecrementDeadNodes();
 			continue;
 		}
 
+		if (IsProtectedQueue(queue_idx)) {
+			// the block is evicted from the protected segment: it has to be used repeatedly again to get back in
+			handle->access_count = 0;
+		}
 		if (!fn(node, handle)) {
 			break;
 		}
 	}
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
+bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
 	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+	return q.try_dequeue(node);
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -208,7 +316,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -216,7 +324,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
@@ -225,6 +333,12 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 }
 
 void BufferPool::PurgeQueue() {
+	for (auto &queue : queues) {
+		queue->Purge();
+	}
+}
+
+void EvictionQueue::Purge() {
 
 	// only one thread purges the queue, all other threads early-out
 	if (!purge_lock.try_lock()) {
@@ -236,7 +350,7 @@ void BufferPool::PurgeQueue() {
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -266,7 +380,7 @@ void BufferPool::PurgeQueue() {
 		PurgeIteration(purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
@@ -305,6 +419,153 @@ void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 		    "Failed to change memory limit to %lld: could not free up enough memory for the new limit%s", limit,
 		    exception_postscript);
 	}
+	lock_guard<mutex> guard(background_eviction_lock);
+	UpdateBackgroundEvictionThreshold();
+}
+
+//===--------------------------------------------------------------------===//
+// Background Eviction
+//===--------------------------------------------------------------------===//
+struct BackgroundEvictionState {
+	//! The lock for waiting on the condition variable
+	mutex lock;
+	//! Notified when background eviction is requested or the thread should stop
+	std::condition_variable cv;
+	//! Whether the thread should stop
+	bool shutdown = false;
+#ifndef DUCKDB_NO_THREADS
+	//! The background eviction thread
+	unique_ptr<thread> eviction_thread;
+#endif
+};
+
+//! The interval at which the background eviction thread checks the used memory, in case a request was missed or
+//! no blocks could be evicted
+static constexpr const int64_t BACKGROUND_EVICTION_INTERVAL_MS = 100;
+
+static idx_t GetWatermarkSize(idx_t maximum_memory, double watermark) {
+	return static_cast<idx_t>(static_cast<double>(maximum_memory) * watermark);
+}
+
+void BufferPool::SetBackgroundEviction(bool enabled) {
+	lock_guard<mutex> guard(background_eviction_lock);
+	if (enabled == (background_eviction != nullptr)) {
+		return;
+	}
+	if (!enabled) {
+		// stop the thread
+		background_eviction_threshold = NumericLimits<idx_t>::Maximum();
+		{
+			lock_guard<mutex> state_guard(background_eviction->lock);
+			background_eviction->shutdown = true;
+		}
+		background_eviction->cv.notify_one();
+#ifndef DUCKDB_NO_THREADS
+		background_eviction->eviction_thread->join();
+#endif
+		background_eviction.reset();
+		return;
+	}
+	background_eviction = make_uniq<BackgroundEvictionState>();
+	background_eviction_requested = false;
+#ifndef DUCKDB_NO_THREADS
+	auto &state = *background_eviction;
+	state.eviction_thread = make_uniq<thread>([this, &state]() { RunBackgroundEviction(state); });
+#endif
+	UpdateBackgroundEvictionThreshold();
+}
+
+void BufferPool::SetBackgroundEvictionWatermarks(double low_watermark, double high_watermark) {
+	D_ASSERT(low_watermark > 0 && low_watermark <= 1);
+	D_ASSERT(high_watermark > 0 && high_watermark <= 1);
+	lock_guard<mutex> guard(background_eviction_lock);
+	background_eviction_low_watermark = low_watermark;
+	background_eviction_high_watermark = high_watermark;
+	UpdateBackgroundEvictionThreshold();
+}
+
+void BufferPool::UpdateBackgroundEvictionThreshold() {
+	if (!background_eviction) {
+		background_eviction_threshold = NumericLimits<idx_t>::Maximum();
+		return;
+	}
+	background_eviction_threshold = GetWatermarkSize(maximum_memory, background_eviction_high_watermark);
+}
+
+void BufferPool::RequestBackgroundEviction() {
+	lock_guard<mutex> guard(background_eviction_lock);
+	if (!background_eviction) {
+		return;
+	}
+	lock_guard<mutex> state_guard(background_eviction->lock);
+	background_eviction->cv.notify_one();
+}
+
+void BufferPool::RunBackgroundEviction(BackgroundEvictionState &state) {
+	unique_lock<mutex> state_guard(state.lock);
+	while (!state.shutdown) {
+		state.cv.wait_for(state_guard, std::chrono::milliseconds(BACKGROUND_EVICTION_INTERVAL_MS),
+		                  [&]() { return state.shutdown || background_eviction_requested; });
+		if (state.shutdown) {
+			break;
+		}
+		// the low watermark cannot be above the high watermark
+		auto high_watermark = background_eviction_high_watermark.load();
+		auto low_watermark = MinValue<double>(background_eviction_low_watermark, high_watermark);
+		if (current_memory <= GetWatermarkSize(maximum_memory, high_watermark)) {
+			background_eviction_requested = false;
+			continue;
+		}
+
+		// evict without holding the lock, so that requests do not wait for the eviction
+		state_guard.unlock();
+		idx_t evicted_blocks = 0;
+		try {
+			evicted_blocks = EvictBlocksInBackground(GetWatermarkSize(maximum_memory, low_watermark));
+		} catch (...) {
+			// an error while writing blocks to the temporary directory (e.g., the disk is full)
+			// the queries that need the memory run into the same error when they evict blocks themselves
+		}
+		state_guard.lock();
+		if (evicted_blocks > 0) {
+			background_eviction_count++;
+			background_evicted_block_count += evicted_blocks;
+			background_eviction_requested = false;
+		} else {
+			// nothing could be evicted (e.g., all blocks are pinned), wait for the interval before trying again
+			state.cv.wait_for(state_guard, std::chrono::milliseconds(BACKGROUND_EVICTION_INTERVAL_MS),
+			                  [&]() { return state.shutdown; });
+			background_eviction_requested = false;
+		}
+	}
+}
+
+idx_t BufferPool::EvictBlocksInBackground(idx_t memory_limit) {
+	idx_t evicted_blocks = 0;
+	for (idx_t queue_idx = 0; queue_idx < queues.size() && current_memory > memory_limit; queue_idx++) {
+		IterateUnloadableBlocks(queue_idx, [&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+			// release the memory and mark the block as unloaded
+			handle->Unload();
+			evicted_blocks++;
+			return current_memory > memory_limit;
+		});
+	}
+	return evicted_blocks;
+}
+
+BufferPoolEvictionStatistics BufferPool::GetEvictionStatistics() const {
+	BufferPoolEvictionStatistics result;
+	result.background_eviction = background_eviction_threshold != NumericLimits<idx_t>::Maximum();
+	auto high_watermark = background_eviction_high_watermark.load();
+	auto low_watermark = MinValue<double>(background_eviction_low_watermark, high_watermark);
+	result.high_watermark = GetWatermarkSize(maximum_memory, high_watermark);
+	result.low_watermark = GetWatermarkSize(maximum_memory, low_watermark);
+	result.reservations = reservation_count;
+	result.inline_evictions = inline_eviction_count;
+	result.inline_evicted_blocks = inline_evicted_block_count;
+	result.background_evictions = background_eviction_count;
+	result.background_evicted_blocks = background_evicted_block_count;
+	return result;
 }
 
 } // namespace duckdb
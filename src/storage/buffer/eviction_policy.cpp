@@ -0,0 +1,37 @@
+#include "duckdb/storage/buffer/eviction_policy.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+namespace duckdb {
+
+EvictionPriority EvictionPolicy::GetPriority(MemoryTag tag) const {
+	switch (tag) {
+	case MemoryTag::METADATA:
+	case MemoryTag::ART_INDEX:
+		return EvictionPriority::HIGH;
+	default:
+		return EvictionPriority::NORMAL;
+	}
+}
+
+unique_ptr<EvictionPolicy> EvictionPolicy::Create(EvictionPolicyType type) {
+	switch (type) {
+	case EvictionPolicyType::LRU:
+		return make_uniq<LRUEvictionPolicy>();
+	case EvictionPolicyType::TWO_QUEUE:
+		return make_uniq<TwoQueueEvictionPolicy>();
+	default:
+		throw InternalException("Unsupported eviction policy type");
+	}
+}
+
+EvictionSegment LRUEvictionPolicy::GetSegment(idx_t access_count) const {
+	return EvictionSegment::PROTECTED;
+}
+
+EvictionSegment TwoQueueEvictionPolicy::GetSegment(idx_t access_count) const {
+	// blocks only move to the protected segment once they are used again
+	return access_count > 1 ? EvictionSegment::PROTECTED : EvictionSegment::PROBATIONARY;
+}
+
+} // namespace duckdb
@@ -12,6 +12,10 @@ shared_ptr<BlockHandle> BufferManager::RegisterSmallMemory(idx_t block_size) {
 	throw NotImplementedException("This type of BufferManager can not create 'small-memory' blocks");
 }
 
+idx_t BufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	return 0;
+}
+
 Allocator &BufferManager::GetBufferAllocator() {
 	throw NotImplementedException("This type of BufferManager does not have an Allocator");
 }
@@ -47,6 +51,14 @@ TemporaryMemoryManager &BufferManager::GetTemporaryMemoryManager() {
 	throw NotImplementedException("This type of BufferManager does not have a TemporaryMemoryManager");
 }
 
+Allocator &BufferManager::GetBlockAllocator() {
+	return Allocator::Get(GetDatabase());
+}
+
+Allocator &BufferManager::GetIOAllocator() {
+	return Allocator::Get(GetDatabase());
+}
+
 void BufferManager::SetTemporaryDirectory(const string &new_dir) {
 	throw NotImplementedException("This type of BufferManager can not set a temporary directory");
 }
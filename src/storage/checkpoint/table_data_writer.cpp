@@ -25,6 +25,14 @@ CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+vector<PhysicalIndex> TableDataWriter::GetSortKeyColumns() {
+	vector<PhysicalIndex> result;
+	for (auto &column_name : table.GetSortKey()) {
+		result.push_back(table.GetColumn(column_name).Physical());
+	}
+	return result;
+}
+
 void TableDataWriter::AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer) {
 	row_group_pointers.push_back(std::move(row_group_pointer));
 }
@@ -868,6 +868,99 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+//! Checks whether any of the next "count" values of the current metadata group can pass the filter, based on the
+//! range of values that the bitpacking mode of the group can represent
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+static bool BitpackingGroupCanMatch(BitpackingScanState<T> &scan_state, const LogicalType &type,
+                                    const TableFilter &filter, idx_t count) {
+	T min_value;
+	T max_value;
+	switch (scan_state.current_group.mode) {
+	case BitpackingMode::CONSTANT:
+		min_value = scan_state.current_constant;
+		max_value = scan_state.current_constant;
+		break;
+	case BitpackingMode::CONSTANT_DELTA: {
+		// intended static casts to unsigned and back for defined wrapping of integers
+		auto first_offset = static_cast<T_U>(scan_state.current_group_offset);
+		auto last_offset = static_cast<T_U>(scan_state.current_group_offset + count - 1);
+		auto first = static_cast<T>(static_cast<T_U>(scan_state.current_constant) * first_offset +
+		                            static_cast<T_U>(scan_state.current_frame_of_reference));
+		auto last = static_cast<T>(static_cast<T_U>(scan_state.current_constant) * last_offset +
+		                           static_cast<T_U>(scan_state.current_frame_of_reference));
+		min_value = MinValue(first, last);
+		max_value = MaxValue(first, last);
+		break;
+	}
+	case BitpackingMode::FOR: {
+		if (scan_state.current_width >= sizeof(T) * 8) {
+			return true;
+		}
+		// all values are in [for, for + 2^width - 1]
+		auto max_delta = static_cast<T_U>((static_cast<T_U>(1) << scan_state.current_width) - 1);
+		auto headroom = static_cast<T_U>(static_cast<T_U>(NumericLimits<T>::Maximum()) -
+		                                 static_cast<T_U>(scan_state.current_frame_of_reference));
+		min_value = scan_state.current_frame_of_reference;
+		max_value = max_delta >= headroom ? NumericLimits<T>::Maximum()
+		                                  : static_cast<T>(static_cast<T_U>(min_value) + max_delta);
+		break;
+	}
+	default:
+		// delta encoded values can be anywhere - we would need to decode them to find out
+		return true;
+	}
+	auto stats = NumericStats::CreateEmpty(type);
+	NumericStats::Update<T>(stats, min_value);
+	NumericStats::Update<T>(stats, max_value);
+	stats.Set(StatsInfo::CAN_HAVE_NULL_AND_VALID_VALUES);
+	return filter.CheckStatistics(stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+template <class T>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+
+	// a vector can span multiple metadata groups: decide for every group whether it needs to be decompressed
+	bool row_matches[STANDARD_VECTOR_SIZE];
+	bool pruned_rows = false;
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		idx_t to_scan =
+		    MinValue<idx_t>(vector_count - scanned, BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+		bool can_match = BitpackingGroupCanMatch<T>(scan_state, segment.type, filter, to_scan);
+		if (can_match) {
+			BitpackingScanPartial<T>(segment, state, to_scan, result, scanned);
+		} else {
+			// only groups that can be accessed at random are pruned, so we can skip them by moving the offset
+			D_ASSERT(scan_state.current_group.mode != BitpackingMode::DELTA_FOR);
+			scan_state.current_group_offset += to_scan;
+			pruned_rows = true;
+		}
+		memset(row_matches + scanned, can_match, to_scan * sizeof(bool));
+		scanned += to_scan;
+	}
+	if (!pruned_rows) {
+		return;
+	}
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (row_matches[idx]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -946,25 +1039,33 @@ CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
 	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
 }
 
+template <class T>
+CompressionFunction GetBitpackingFilterFunction(PhysicalType data_type) {
+	auto result = GetBitpackingFunction<T>(data_type);
+	result.filter = BitpackingFilter<T>;
+	return result;
+}
+
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::BOOL:
-	case PhysicalType::INT8:
 		return GetBitpackingFunction<int8_t>(type);
+	case PhysicalType::INT8:
+		return GetBitpackingFilterFunction<int8_t>(type);
 	case PhysicalType::INT16:
-		return GetBitpackingFunction<int16_t>(type);
+		return GetBitpackingFilterFunction<int16_t>(type);
 	case PhysicalType::INT32:
-		return GetBitpackingFunction<int32_t>(type);
+		return GetBitpackingFilterFunction<int32_t>(type);
 	case PhysicalType::INT64:
-		return GetBitpackingFunction<int64_t>(type);
+		return GetBitpackingFilterFunction<int64_t>(type);
 	case PhysicalType::UINT8:
-		return GetBitpackingFunction<uint8_t>(type);
+		return GetBitpackingFilterFunction<uint8_t>(type);
 	case PhysicalType::UINT16:
-		return GetBitpackingFunction<uint16_t>(type);
+		return GetBitpackingFilterFunction<uint16_t>(type);
 	case PhysicalType::UINT32:
-		return GetBitpackingFunction<uint32_t>(type);
+		return GetBitpackingFilterFunction<uint32_t>(type);
 	case PhysicalType::UINT64:
-		return GetBitpackingFunction<uint64_t>(type);
+		return GetBitpackingFilterFunction<uint64_t>(type);
 	case PhysicalType::INT128:
 		return GetBitpackingFunction<hugeint_t>(type);
 	case PhysicalType::UINT128:
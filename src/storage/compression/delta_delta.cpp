@@ -0,0 +1,581 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+// Delta-of-delta compression stores sorted (or nearly sorted) integer columns - such as auto-incrementing ids or
+// event timestamps - as the difference between consecutive deltas. For such columns the deltas are small and
+// similar, which makes the delta-of-deltas tiny even when the deltas themselves are irregular.
+//
+// The values are split into groups of DELTA_DELTA_GROUP_SIZE values. Every group is stored as a header followed by
+// the bitpacked delta-of-deltas:
+// [first value][first delta][frame of reference][min][max][width][bitpacked delta-of-deltas - frame of reference]
+// The groups are followed by a directory with the offset of every group, which allows seeking to any row by only
+// decoding (part of) a single group. The min/max of every group are used to skip groups when filtering.
+// All arithmetic is done on the unsigned type, so wrapping is well-defined and the encoding is lossless for any input.
+static constexpr const idx_t DELTA_DELTA_GROUP_SIZE = 512;
+static constexpr const idx_t DELTA_DELTA_HEADER_SIZE = sizeof(uint64_t);
+
+using delta_delta_offset_t = uint32_t;
+
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+struct DeltaDeltaGroupHeader {
+	static constexpr const idx_t FIELD_COUNT = 6;
+	static constexpr const idx_t SIZE = FIELD_COUNT * sizeof(T);
+
+	T first_value;
+	T first_delta;
+	T frame_of_reference;
+	T min;
+	T max;
+	bitpacking_width_t width;
+
+	void Write(data_ptr_t ptr) const {
+		Store<T>(first_value, ptr);
+		Store<T>(first_delta, ptr + sizeof(T));
+		Store<T>(frame_of_reference, ptr + 2 * sizeof(T));
+		Store<T>(min, ptr + 3 * sizeof(T));
+		Store<T>(max, ptr + 4 * sizeof(T));
+		Store<T>(static_cast<T>(width), ptr + 5 * sizeof(T));
+	}
+
+	static DeltaDeltaGroupHeader Read(data_ptr_t ptr) {
+		DeltaDeltaGroupHeader result;
+		result.first_value = Load<T>(ptr);
+		result.first_delta = Load<T>(ptr + sizeof(T));
+		result.frame_of_reference = Load<T>(ptr + 2 * sizeof(T));
+		result.min = Load<T>(ptr + 3 * sizeof(T));
+		result.max = Load<T>(ptr + 4 * sizeof(T));
+		result.width = static_cast<bitpacking_width_t>(Load<T>(ptr + 5 * sizeof(T)));
+		return result;
+	}
+};
+
+//! Buffers the values of a single group and computes its encoding
+template <class T, class T_S = typename MakeSigned<T>::type, class T_U = typename MakeUnsigned<T>::type>
+struct DeltaDeltaGroupEncoder {
+	T values[DELTA_DELTA_GROUP_SIZE];
+	bool validity[DELTA_DELTA_GROUP_SIZE];
+	idx_t count = 0;
+	idx_t valid_count = 0;
+
+	//! The encoded group - populated by Encode()
+	DeltaDeltaGroupHeader<T> header;
+	T_U packed[DELTA_DELTA_GROUP_SIZE];
+
+	bool IsFull() const {
+		return count == DELTA_DELTA_GROUP_SIZE;
+	}
+
+	void Append(T value, bool is_valid) {
+		values[count] = value;
+		validity[count] = is_valid;
+		valid_count += is_valid;
+		count++;
+	}
+
+	void Reset() {
+		count = 0;
+		valid_count = 0;
+	}
+
+	//! Compute the header and the (not yet bitpacked) delta-of-deltas of the buffered values
+	void Encode() {
+		D_ASSERT(count > 0);
+		FillNulls();
+		header.min = values[0];
+		header.max = values[0];
+		for (idx_t i = 0; i < count; i++) {
+			if (validity[i] || valid_count == 0) {
+				header.min = MinValue(header.min, values[i]);
+				header.max = MaxValue(header.max, values[i]);
+			}
+		}
+		header.first_value = values[0];
+		header.first_delta = count > 1 ? static_cast<T>(static_cast<T_U>(values[1]) - static_cast<T_U>(values[0])) : 0;
+		header.frame_of_reference = 0;
+		header.width = 0;
+		if (count <= 2) {
+			return;
+		}
+		// compute the delta-of-deltas, and the minimum (signed) delta-of-delta as frame of reference
+		auto previous_delta = static_cast<T_U>(header.first_delta);
+		T_S min_delta_of_delta = NumericLimits<T_S>::Maximum();
+		for (idx_t i = 2; i < count; i++) {
+			auto delta = static_cast<T_U>(static_cast<T_U>(values[i]) - static_cast<T_U>(values[i - 1]));
+			auto delta_of_delta = static_cast<T_U>(delta - previous_delta);
+			packed[i - 2] = delta_of_delta;
+			min_delta_of_delta = MinValue(min_delta_of_delta, static_cast<T_S>(delta_of_delta));
+			previous_delta = delta;
+		}
+		T_U max_packed = 0;
+		for (idx_t i = 0; i < count - 2; i++) {
+			packed[i] = static_cast<T_U>(packed[i] - static_cast<T_U>(min_delta_of_delta));
+			max_packed = MaxValue(max_packed, packed[i]);
+		}
+		header.frame_of_reference = static_cast<T>(min_delta_of_delta);
+		header.width = BitpackingPrimitives::MinimumBitWidth<T_U, false>(max_packed);
+	}
+
+	//! The size of the encoded group in bytes - requires Encode() to be called first
+	idx_t EncodedSize() const {
+		idx_t packed_count = count > 2 ? count - 2 : 0;
+		return AlignValue(DeltaDeltaGroupHeader<T>::SIZE +
+		                  BitpackingPrimitives::GetRequiredSize(packed_count, header.width));
+	}
+
+	void Write(data_ptr_t ptr) {
+		header.Write(ptr);
+		if (count > 2) {
+			BitpackingPrimitives::PackBuffer<T_U, false>(ptr + DeltaDeltaGroupHeader<T>::SIZE, packed, count - 2,
+			                                             header.width);
+		}
+	}
+
+private:
+	//! NULL values can have any value - give them the value of the preceding (or first) valid row so they do not
+	//! disturb the deltas
+	void FillNulls() {
+		if (valid_count == count) {
+			return;
+		}
+		if (valid_count == 0) {
+			for (idx_t i = 0; i < count; i++) {
+				values[i] = 0;
+			}
+			return;
+		}
+		idx_t first_valid = 0;
+		while (!validity[first_valid]) {
+			first_valid++;
+		}
+		for (idx_t i = 0; i < first_valid; i++) {
+			values[i] = values[first_valid];
+		}
+		for (idx_t i = first_valid + 1; i < count; i++) {
+			if (!validity[i]) {
+				values[i] = values[i - 1];
+			}
+		}
+	}
+};
+
+//! Decodes the first "count" values of the group stored at "group_ptr"
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+static void DeltaDeltaDecodeGroup(data_ptr_t group_ptr, idx_t count, T *result) {
+	D_ASSERT(count > 0 && count <= DELTA_DELTA_GROUP_SIZE);
+	auto header = DeltaDeltaGroupHeader<T>::Read(group_ptr);
+	result[0] = header.first_value;
+	if (count == 1) {
+		return;
+	}
+	auto value = static_cast<T_U>(static_cast<T_U>(header.first_value) + static_cast<T_U>(header.first_delta));
+	result[1] = static_cast<T>(value);
+	if (count == 2) {
+		return;
+	}
+	// unpack the delta-of-deltas
+	idx_t packed_count = count - 2;
+	T_U delta_of_deltas[DELTA_DELTA_GROUP_SIZE];
+	BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(delta_of_deltas), group_ptr + DeltaDeltaGroupHeader<T>::SIZE,
+	                                        BitpackingPrimitives::RoundUpToAlgorithmGroupSize(packed_count),
+	                                        header.width, true);
+	// apply the frame of reference
+	auto frame_of_reference = static_cast<T_U>(header.frame_of_reference);
+	for (idx_t i = 0; i < packed_count; i++) {
+		delta_of_deltas[i] = static_cast<T_U>(delta_of_deltas[i] + frame_of_reference);
+	}
+	// integrate twice: delta-of-deltas to deltas, and deltas to values
+	auto delta = static_cast<T_U>(header.first_delta);
+	for (idx_t i = 0; i < packed_count; i++) {
+		delta = static_cast<T_U>(delta + delta_of_deltas[i]);
+		value = static_cast<T_U>(value + delta);
+		result[i + 2] = static_cast<T>(value);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaDeltaAnalyzeState : public AnalyzeState {
+	DeltaDeltaGroupEncoder<T> encoder;
+	idx_t total_size = 0;
+	idx_t segment_size = DELTA_DELTA_HEADER_SIZE;
+
+	void FlushGroup() {
+		if (encoder.count == 0) {
+			return;
+		}
+		encoder.Encode();
+		auto group_size = encoder.EncodedSize() + sizeof(delta_delta_offset_t);
+		if (segment_size + group_size > Storage::BLOCK_SIZE) {
+			// the group does not fit in the current segment anymore
+			total_size += segment_size;
+			segment_size = DELTA_DELTA_HEADER_SIZE;
+		}
+		segment_size += group_size;
+		encoder.Reset();
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> DeltaDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<DeltaDeltaAnalyzeState<T>>();
+}
+
+template <class T>
+bool DeltaDeltaAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<DeltaDeltaAnalyzeState<T>>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.encoder.Append(data[idx], vdata.validity.RowIsValid(idx));
+		if (state.encoder.IsFull()) {
+			state.FlushGroup();
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t DeltaDeltaFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<DeltaDeltaAnalyzeState<T>>();
+	state.FlushGroup();
+	return state.total_size + state.segment_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+struct DeltaDeltaCompressState : public CompressionState {
+	explicit DeltaDeltaCompressState(ColumnDataCheckpointer &checkpointer_p)
+	    : checkpointer(checkpointer_p),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_DELTA_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	DeltaDeltaGroupEncoder<T> encoder;
+	//! The offset at which the next group is written
+	idx_t data_offset;
+	//! The offsets of the groups written to the current segment
+	vector<delta_delta_offset_t> group_offsets;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+		data_offset = DELTA_DELTA_HEADER_SIZE;
+		group_offsets.clear();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			auto is_valid = vdata.validity.RowIsValid(idx);
+			encoder.Append(data[idx], is_valid);
+			if (encoder.IsFull()) {
+				FlushGroup();
+			}
+		}
+	}
+
+	void FlushGroup() {
+		if (encoder.count == 0) {
+			return;
+		}
+		encoder.Encode();
+		auto group_size = encoder.EncodedSize();
+		auto directory_size = (group_offsets.size() + 1) * sizeof(delta_delta_offset_t);
+		if (data_offset + group_size + directory_size > Storage::BLOCK_SIZE) {
+			// the group does not fit: flush the current segment and start a new one
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		// the statistics are only updated once it is known which segment the group ends up in
+		if (encoder.valid_count > 0) {
+			NumericStats::Update<T>(current_segment->stats.statistics, encoder.header.min);
+			NumericStats::Update<T>(current_segment->stats.statistics, encoder.header.max);
+		}
+		encoder.Write(handle.Ptr() + data_offset);
+		group_offsets.push_back(NumericCast<delta_delta_offset_t>(data_offset));
+		data_offset += group_size;
+		current_segment->count += encoder.count;
+		encoder.Reset();
+	}
+
+	void FlushSegment() {
+		// write the group directory directly after the groups
+		auto base_ptr = handle.Ptr();
+		auto directory_offset = data_offset;
+		memcpy(base_ptr + directory_offset, group_offsets.data(), group_offsets.size() * sizeof(delta_delta_offset_t));
+		Store<uint64_t>(directory_offset, base_ptr);
+		auto total_segment_size = directory_offset + group_offsets.size() * sizeof(delta_delta_offset_t);
+		handle.Destroy();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		FlushGroup();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> DeltaDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                       unique_ptr<AnalyzeState> state) {
+	return make_uniq<DeltaDeltaCompressState<T>>(checkpointer);
+}
+
+template <class T>
+void DeltaDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<DeltaDeltaCompressState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void DeltaDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<DeltaDeltaCompressState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct DeltaDeltaScanState : public SegmentScanState {
+	explicit DeltaDeltaScanState(ColumnSegment &segment) : segment(segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		group_offsets = reinterpret_cast<delta_delta_offset_t *>(base_ptr + Load<uint64_t>(base_ptr));
+	}
+
+	ColumnSegment &segment;
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	delta_delta_offset_t *group_offsets;
+	//! The row (relative to the start of the segment) the scan is at
+	idx_t position = 0;
+	//! The group that is currently decoded in "decoded_values"
+	optional_idx decoded_group;
+	T decoded_values[DELTA_DELTA_GROUP_SIZE];
+
+public:
+	data_ptr_t GetGroupPointer(idx_t group_idx) {
+		return base_ptr + Load<delta_delta_offset_t>(data_ptr_cast(group_offsets + group_idx));
+	}
+
+	idx_t GetGroupCount(idx_t group_idx) {
+		return MinValue<idx_t>(DELTA_DELTA_GROUP_SIZE, segment.count - group_idx * DELTA_DELTA_GROUP_SIZE);
+	}
+
+	void DecodeGroup(idx_t group_idx) {
+		if (decoded_group.IsValid() && decoded_group.GetIndex() == group_idx) {
+			return;
+		}
+		DeltaDeltaDecodeGroup<T>(GetGroupPointer(group_idx), GetGroupCount(group_idx), decoded_values);
+		decoded_group = group_idx;
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> DeltaDeltaInitScan(ColumnSegment &segment) {
+	return make_uniq<DeltaDeltaScanState<T>>(segment);
+}
+
+template <class T>
+void DeltaDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                           idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<DeltaDeltaScanState<T>>();
+	D_ASSERT(scan_state.position == segment.GetRelativeIndex(state.row_index));
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto group_idx = scan_state.position / DELTA_DELTA_GROUP_SIZE;
+		auto offset_in_group = scan_state.position % DELTA_DELTA_GROUP_SIZE;
+		auto group_count = scan_state.GetGroupCount(group_idx);
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, group_count - offset_in_group);
+		if (offset_in_group == 0 && to_scan == group_count) {
+			// decode the entire group directly into the result
+			DeltaDeltaDecodeGroup<T>(scan_state.GetGroupPointer(group_idx), group_count,
+			                         result_data + result_offset + scanned);
+		} else {
+			scan_state.DecodeGroup(group_idx);
+			memcpy(result_data + result_offset + scanned, scan_state.decoded_values + offset_in_group,
+			       to_scan * sizeof(T));
+		}
+		scanned += to_scan;
+		scan_state.position += to_scan;
+	}
+}
+
+template <class T>
+void DeltaDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	DeltaDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+template <class T>
+void DeltaDeltaSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = state.scan_state->Cast<DeltaDeltaScanState<T>>();
+	// every group can be decoded independently - skipping only moves the position
+	scan_state.position += skip_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void DeltaDeltaFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<DeltaDeltaScanState<T>>();
+
+	// use the min/max of every group to skip decoding the groups that cannot match
+	bool row_matches[STANDARD_VECTOR_SIZE];
+	bool pruned_rows = false;
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		auto group_idx = scan_state.position / DELTA_DELTA_GROUP_SIZE;
+		auto offset_in_group = scan_state.position % DELTA_DELTA_GROUP_SIZE;
+		auto to_scan = MinValue<idx_t>(vector_count - scanned, scan_state.GetGroupCount(group_idx) - offset_in_group);
+
+		auto header = DeltaDeltaGroupHeader<T>::Read(scan_state.GetGroupPointer(group_idx));
+		auto stats = NumericStats::CreateEmpty(segment.type);
+		NumericStats::Update<T>(stats, header.min);
+		NumericStats::Update<T>(stats, header.max);
+		stats.Set(StatsInfo::CAN_HAVE_NULL_AND_VALID_VALUES);
+		bool can_match = filter.CheckStatistics(stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		if (can_match) {
+			scan_state.DecodeGroup(group_idx);
+			memcpy(result_data + scanned, scan_state.decoded_values + offset_in_group, to_scan * sizeof(T));
+		} else {
+			pruned_rows = true;
+		}
+		memset(row_matches + scanned, can_match, to_scan * sizeof(bool));
+		scanned += to_scan;
+		scan_state.position += to_scan;
+	}
+	if (!pruned_rows) {
+		return;
+	}
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (row_matches[idx]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void DeltaDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                        idx_t result_idx) {
+	auto &handle = state.GetOrInsertHandle(segment);
+	auto base_ptr = handle.Ptr() + segment.GetBlockOffset();
+	auto group_offsets = base_ptr + Load<uint64_t>(base_ptr);
+
+	// only decode the group containing the row, up to the row
+	auto row = NumericCast<idx_t>(row_id);
+	auto group_idx = row / DELTA_DELTA_GROUP_SIZE;
+	auto offset_in_group = row % DELTA_DELTA_GROUP_SIZE;
+	auto group_ptr =
+	    base_ptr + Load<delta_delta_offset_t>(group_offsets + group_idx * sizeof(delta_delta_offset_t));
+	T decoded_values[DELTA_DELTA_GROUP_SIZE];
+	DeltaDeltaDecodeGroup<T>(group_ptr, offset_in_group + 1, decoded_values);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result_data[result_idx] = decoded_values[offset_in_group];
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetDeltaDeltaFunction(PhysicalType data_type) {
+	auto result = CompressionFunction(CompressionType::COMPRESSION_DELTA_DELTA, data_type, DeltaDeltaInitAnalyze<T>,
+	                                  DeltaDeltaAnalyze<T>, DeltaDeltaFinalAnalyze<T>, DeltaDeltaInitCompression<T>,
+	                                  DeltaDeltaCompress<T>, DeltaDeltaFinalizeCompress<T>, DeltaDeltaInitScan<T>,
+	                                  DeltaDeltaScan<T>, DeltaDeltaScanPartial<T>, DeltaDeltaFetchRow<T>,
+	                                  DeltaDeltaSkip<T>);
+	result.filter = DeltaDeltaFilter<T>;
+	return result;
+}
+
+CompressionFunction DeltaDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return GetDeltaDeltaFunction<int8_t>(type);
+	case PhysicalType::INT16:
+		return GetDeltaDeltaFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetDeltaDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetDeltaDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT8:
+		return GetDeltaDeltaFunction<uint8_t>(type);
+	case PhysicalType::UINT16:
+		return GetDeltaDeltaFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetDeltaDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetDeltaDeltaFunction<uint64_t>(type);
+	default:
+		throw InternalException("Unsupported type for delta-of-delta compression");
+	}
+}
+
+bool DeltaDeltaFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -104,6 +104,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -429,9 +431,14 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The filter for which "filter_matches" was computed
+	optional_ptr<const TableFilter> filter;
+	//! For every dictionary entry, whether or not it passes the filter
+	unsafe_unique_array<bool> filter_matches;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -451,6 +458,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -483,8 +491,7 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
 	auto result_data = FlatVector::GetData<string_t>(result);
 
-	if (!ALLOW_DICT_VECTORS || scan_count != STANDARD_VECTOR_SIZE ||
-	    start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE != 0) {
+	if (!ALLOW_DICT_VECTORS) {
 		// Emit regular vector
 
 		// Handling non-bitpacking-group-aligned start values;
@@ -515,25 +522,22 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 		}
 
 	} else {
-		D_ASSERT(start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE == 0);
-		D_ASSERT(scan_count == STANDARD_VECTOR_SIZE);
 		D_ASSERT(result_offset == 0);
 
-		idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count);
+		// Emit a dictionary vector that references the dictionary of the segment. Every emitted vector gets its own
+		// selection vector, as the result can outlive the next scan of this segment.
+		idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+		SelectionVector sel_vec(decompress_count);
 
-		// Create a selection vector of sufficient size if we don't already have one.
-		if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
-			scan_state.sel_vec_size = decompress_count;
-			scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+		data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+		BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(sel_vec.data()), src, decompress_count,
+		                                          scan_state.current_width);
+		if (start_offset != 0) {
+			memmove(sel_vec.data(), sel_vec.data() + start_offset, scan_count * sizeof(sel_t));
 		}
 
-		// Scanning 1024 values, emitting a dict vector
-		data_ptr_t dst = data_ptr_cast(scan_state.sel_vec->data());
-		data_ptr_t src = data_ptr_cast(&base_data[(start * scan_state.current_width) / 8]);
-
-		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
-
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		result.Dictionary(*(scan_state.dictionary), scan_state.dictionary_size, sel_vec, scan_count);
 	}
 }
 
@@ -542,6 +546,66 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	if (scan_state.filter.get() != &filter) {
+		// evaluate the filter once for every entry in the dictionary
+		SelectionVector dictionary_sel;
+		idx_t dictionary_approved = scan_state.dictionary_size;
+		UnifiedVectorFormat dictionary_data;
+		scan_state.dictionary->ToUnifiedFormat(scan_state.dictionary_size, dictionary_data);
+		ColumnSegment::FilterSelection(dictionary_sel, *scan_state.dictionary, dictionary_data, filter,
+		                               scan_state.dictionary_size, dictionary_approved);
+
+		scan_state.filter_matches = make_unsafe_uniq_array<bool>(scan_state.dictionary_size);
+		memset(scan_state.filter_matches.get(), 0, scan_state.dictionary_size * sizeof(bool));
+		for (idx_t i = 0; i < dictionary_approved; i++) {
+			scan_state.filter_matches[dictionary_sel.get_index(i)] = true;
+		}
+		scan_state.filter = &filter;
+	}
+
+	// decompress the selection buffer of this vector
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(vector_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(scan_state.sel_vec->data()), src, decompress_count,
+	                                          scan_state.current_width);
+
+	// prune the rows that refer to dictionary entries that do not pass the filter
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (scan_state.filter_matches[scan_state.sel_vec->get_index(idx + start_offset)]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	if (result_count == 0) {
+		return;
+	}
+
+	// emit a dictionary vector over the (already decompressed) selection buffer
+	SelectionVector dictionary_sel(vector_count);
+	memcpy(dictionary_sel.data(), scan_state.sel_vec->data() + start_offset, vector_count * sizeof(sel_t));
+	result.Dictionary(*(scan_state.dictionary), scan_state.dictionary_size, dictionary_sel, vector_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -638,13 +702,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto result = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	result.filter = DictionaryCompressionStorage::StringFilter;
+	return result;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
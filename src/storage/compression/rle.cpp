@@ -372,6 +372,66 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result, SelectionVector &sel,
+               idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// gather the values of the runs that overlap with this vector
+	Vector run_values(segment.type, vector_count);
+	auto run_data = FlatVector::GetData<T>(run_values);
+	idx_t run_end[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	idx_t entry_pos = scan_state.entry_pos;
+	idx_t position_in_entry = scan_state.position_in_entry;
+	for (idx_t scanned = 0; scanned < vector_count; run_count++) {
+		run_data[run_count] = data_pointer[entry_pos];
+		scanned += MinValue<idx_t>(index_pointer[entry_pos] - position_in_entry, vector_count - scanned);
+		run_end[run_count] = scanned;
+		entry_pos++;
+		position_in_entry = 0;
+	}
+
+	// evaluate the filter once per run
+	SelectionVector run_sel;
+	idx_t run_approved = run_count;
+	UnifiedVectorFormat run_format;
+	run_values.ToUnifiedFormat(run_count, run_format);
+	ColumnSegment::FilterSelection(run_sel, run_values, run_format, filter, run_count, run_approved);
+	if (run_approved < run_count) {
+		// prune the rows that belong to runs that do not pass the filter
+		bool row_matches[STANDARD_VECTOR_SIZE];
+		memset(row_matches, 0, vector_count * sizeof(bool));
+		for (idx_t i = 0; i < run_approved; i++) {
+			auto run_idx = run_sel.get_index(i);
+			auto run_start = run_idx == 0 ? 0 : run_end[run_idx - 1];
+			memset(row_matches + run_start, 1, (run_end[run_idx] - run_start) * sizeof(bool));
+		}
+		SelectionVector new_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (row_matches[idx]) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(new_sel);
+		approved_tuple_count = result_count;
+	}
+	if (approved_tuple_count == 0) {
+		scan_state.Skip(segment, vector_count);
+		return;
+	}
+	RLEScanPartialInternal<T, true>(segment, state, vector_count, result, 0);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -391,10 +451,12 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	auto result = CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                                  RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                                  RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                                  RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	result.filter = RLEFilter<T>;
+	return result;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
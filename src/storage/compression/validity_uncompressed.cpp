@@ -340,10 +340,36 @@ void ValidityScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t s
 #endif
 }
 
+//! Returns true if none of the rows in the range [start, start + count) are NULL
+static bool ValidityRangeIsAllValid(const validity_t *input_data, idx_t start, idx_t count) {
+	idx_t end = start + count;
+	while (start < end) {
+		auto entry = input_data[start / ValidityMask::BITS_PER_VALUE];
+		idx_t bit_idx = start % ValidityMask::BITS_PER_VALUE;
+		idx_t bit_count = MinValue<idx_t>(ValidityMask::BITS_PER_VALUE - bit_idx, end - start);
+		validity_t required_bits = bit_count == ValidityMask::BITS_PER_VALUE
+		                               ? ValidityMask::ValidityBuffer::MAX_ENTRY
+		                               : ((validity_t(1) << bit_count) - 1) << bit_idx;
+		if ((entry & required_bits) != required_bits) {
+			return false;
+		}
+		start += bit_count;
+	}
+	return true;
+}
+
 void ValidityScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	auto start = segment.GetRelativeIndex(state.row_index);
+	if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		// keep dictionary vectors emitted by the scan of the data intact if there are no NULL values to merge
+		auto &scan_state = state.scan_state->Cast<ValidityScanState>();
+		auto input_data = reinterpret_cast<validity_t *>(scan_state.handle.Ptr() + segment.GetBlockOffset());
+		if (ValidityRangeIsAllValid(input_data, start, scan_count)) {
+			return;
+		}
+	}
 	result.Flatten(scan_count);
 
-	auto start = segment.GetRelativeIndex(state.row_index);
 	if (start % ValidityMask::BITS_PER_VALUE == 0) {
 		auto &scan_state = state.scan_state->Cast<ValidityScanState>();
 
@@ -0,0 +1,525 @@
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a sequence of independently compressed frames, each holding at most one vector of
+// strings. The frame directory is stored directly after the compressed data.
+//
+// | header | frame 0 | frame 1 | ... | frame N-1 | frame directory (N entries) |
+//
+// The uncompressed content of a frame is the list of string lengths followed by the concatenated string data.
+// This allows scans to decompress a single vector at a time instead of the whole segment.
+typedef struct {
+	uint32_t frame_count;
+	uint32_t directory_offset;
+} zstd_segment_header_t;
+
+typedef struct {
+	uint32_t data_offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+	uint32_t row_count;
+} zstd_frame_entry_t;
+
+struct ZSTDStorage {
+	//! The compression level used for all frames
+	static constexpr int COMPRESSION_LEVEL = 3;
+	//! The maximum number of uncompressed bytes in a single frame, this guarantees that any frame fits in an
+	//! empty segment
+	static constexpr idx_t MAX_FRAME_SIZE = Storage::BLOCK_SIZE / 2;
+	//! The maximum size of a single string that can be stored in a frame
+	static constexpr idx_t MAX_STRING_SIZE = MAX_FRAME_SIZE - sizeof(uint32_t);
+	//! Decompressing ZSTD is considerably slower than FSST or dictionary, require a real win before choosing it
+	static constexpr double MINIMUM_COMPRESSION_RATIO = 1.5;
+	static constexpr double ANALYSIS_SAMPLE_SIZE = 0.25;
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+};
+
+//===--------------------------------------------------------------------===//
+// Frame Builder
+//===--------------------------------------------------------------------===//
+//! Collects strings into the uncompressed representation of a single frame
+struct ZSTDFrameBuilder {
+	vector<uint32_t> lengths;
+	vector<char> string_data;
+
+	idx_t RowCount() const {
+		return lengths.size();
+	}
+	idx_t UncompressedSize() const {
+		return lengths.size() * sizeof(uint32_t) + string_data.size();
+	}
+	bool IsFull() const {
+		return lengths.size() >= STANDARD_VECTOR_SIZE;
+	}
+	bool CanAppend(idx_t string_size) const {
+		return !IsFull() && UncompressedSize() + sizeof(uint32_t) + string_size <= ZSTDStorage::MAX_FRAME_SIZE;
+	}
+	void Append(const string_t &str) {
+		auto size = str.GetSize();
+		lengths.push_back(NumericCast<uint32_t>(size));
+		string_data.insert(string_data.end(), str.GetData(), str.GetData() + size);
+	}
+	void AppendEmpty() {
+		lengths.push_back(0);
+	}
+	void Clear() {
+		lengths.clear();
+		string_data.clear();
+	}
+	//! Compresses the frame into the target buffer, returns the compressed size
+	idx_t Compress(duckdb_zstd::ZSTD_CCtx *context, vector<data_t> &target) {
+		auto uncompressed_size = UncompressedSize();
+		auto uncompressed = make_unsafe_uniq_array<data_t>(uncompressed_size);
+		auto lengths_size = lengths.size() * sizeof(uint32_t);
+		memcpy(uncompressed.get(), lengths.data(), lengths_size);
+		if (!string_data.empty()) {
+			memcpy(uncompressed.get() + lengths_size, string_data.data(), string_data.size());
+		}
+		target.resize(duckdb_zstd::ZSTD_compressBound(uncompressed_size));
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, target.data(), target.size(), uncompressed.get(),
+		                                                      uncompressed_size, ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		return compressed_size;
+	}
+};
+
+//! RAII wrapper around a ZSTD compression context
+struct ZSTDCompressionContext {
+	ZSTDCompressionContext() : context(duckdb_zstd::ZSTD_createCCtx()) {
+		if (!context) {
+			throw InternalException("Failed to create ZSTD compression context");
+		}
+	}
+	~ZSTDCompressionContext() {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	ZSTDAnalyzeState()
+	    : total_vectors(0), sampled_vectors(0), sampled_frames(0), sampled_compressed_size(0), string_count(0) {
+	}
+
+	ZSTDCompressionContext context;
+	ZSTDFrameBuilder frame;
+	vector<data_t> compress_buffer;
+	RandomEngine random_engine;
+
+	idx_t total_vectors;
+	idx_t sampled_vectors;
+	idx_t sampled_frames;
+	idx_t sampled_compressed_size;
+	//! The amount of non-NULL strings
+	idx_t string_count;
+
+	void FlushFrame() {
+		if (frame.RowCount() == 0) {
+			return;
+		}
+		sampled_compressed_size += frame.Compress(context.context, compress_buffer);
+		sampled_frames++;
+		frame.Clear();
+	}
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_uniq<ZSTDAnalyzeState>();
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	state.total_vectors++;
+	// always sample the first vector so we have something to base the estimate on
+	bool sample_selected = state.sampled_vectors == 0 || state.random_engine.NextRandom() < ANALYSIS_SAMPLE_SIZE;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			if (sample_selected) {
+				state.frame.AppendEmpty();
+			}
+			continue;
+		}
+		// we need to check all strings for this, otherwise we might not be able to store a string during compression
+		auto string_size = data[idx].GetSize();
+		if (string_size > MAX_STRING_SIZE) {
+			return false;
+		}
+		state.string_count++;
+		if (!sample_selected) {
+			continue;
+		}
+		if (!state.frame.CanAppend(string_size)) {
+			state.FlushFrame();
+		}
+		state.frame.Append(data[idx]);
+	}
+	if (sample_selected) {
+		state.sampled_vectors++;
+		state.FlushFrame();
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.sampled_vectors == 0 || state.string_count == 0) {
+		// there is nothing to compress if all strings are NULL
+		return DConstants::INVALID_INDEX;
+	}
+	auto sampled_size = state.sampled_compressed_size + state.sampled_frames * sizeof(zstd_frame_entry_t);
+	auto scale = double(state.total_vectors) / double(state.sampled_vectors);
+	auto estimated_size = double(sampled_size) * scale;
+	auto num_segments = estimated_size / double(Storage::BLOCK_SIZE);
+	estimated_size += num_segments * sizeof(zstd_segment_header_t);
+	return NumericCast<idx_t>(estimated_size * MINIMUM_COMPRESSION_RATIO);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	explicit ZSTDCompressionState(ColumnDataCheckpointer &checkpointer)
+	    : checkpointer(checkpointer), function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment = std::move(compressed_segment);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		data_end = sizeof(zstd_segment_header_t);
+		frames.clear();
+	}
+
+	void AddNull() {
+		if (!frame.CanAppend(0)) {
+			FlushFrame();
+		}
+		frame.AppendEmpty();
+		frame_validity.push_back(false);
+	}
+
+	void AddString(const string_t &str) {
+		if (!frame.CanAppend(str.GetSize())) {
+			FlushFrame();
+		}
+		frame.Append(str);
+		frame_validity.push_back(true);
+	}
+
+	bool HasEnoughSpace(idx_t compressed_size) {
+		auto directory_size = (frames.size() + 1) * sizeof(zstd_frame_entry_t);
+		return data_end + compressed_size + directory_size <= Storage::BLOCK_SIZE;
+	}
+
+	void FlushFrame() {
+		if (frame.RowCount() == 0) {
+			return;
+		}
+		auto compressed_size = frame.Compress(context.context, compress_buffer);
+		if (!HasEnoughSpace(compressed_size)) {
+			FlushSegment();
+			if (!HasEnoughSpace(compressed_size)) {
+				throw InternalException("ZSTD compression failed due to insufficient space in empty block");
+			}
+		}
+		memcpy(current_handle.Ptr() + data_end, compress_buffer.data(), compressed_size);
+
+		zstd_frame_entry_t entry;
+		entry.data_offset = NumericCast<uint32_t>(data_end);
+		entry.compressed_size = NumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = NumericCast<uint32_t>(frame.UncompressedSize());
+		entry.row_count = NumericCast<uint32_t>(frame.RowCount());
+		frames.push_back(entry);
+		data_end += compressed_size;
+
+		// now that we know which segment holds the frame, update the segment statistics
+		idx_t string_offset = 0;
+		for (idx_t i = 0; i < frame.RowCount(); i++) {
+			auto length = frame.lengths[i];
+			if (frame_validity[i]) {
+				string_t str(frame.string_data.data() + string_offset, length);
+				UncompressedStringStorage::UpdateStringStats(current_segment->stats, str);
+			}
+			string_offset += length;
+		}
+		current_segment->count += frame.RowCount();
+
+		frame.Clear();
+		frame_validity.clear();
+	}
+
+	idx_t Finalize() {
+		auto base_ptr = current_handle.Ptr();
+		auto directory_offset = data_end;
+		for (idx_t i = 0; i < frames.size(); i++) {
+			auto entry_ptr = base_ptr + directory_offset + i * sizeof(zstd_frame_entry_t);
+			Store<uint32_t>(frames[i].data_offset, entry_ptr + offsetof(zstd_frame_entry_t, data_offset));
+			Store<uint32_t>(frames[i].compressed_size, entry_ptr + offsetof(zstd_frame_entry_t, compressed_size));
+			Store<uint32_t>(frames[i].uncompressed_size,
+			                entry_ptr + offsetof(zstd_frame_entry_t, uncompressed_size));
+			Store<uint32_t>(frames[i].row_count, entry_ptr + offsetof(zstd_frame_entry_t, row_count));
+		}
+		auto header_ptr = reinterpret_cast<zstd_segment_header_t *>(base_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(frames.size()), data_ptr_cast(&header_ptr->frame_count));
+		Store<uint32_t>(NumericCast<uint32_t>(directory_offset), data_ptr_cast(&header_ptr->directory_offset));
+		return directory_offset + frames.size() * sizeof(zstd_frame_entry_t);
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+		auto segment_size = Finalize();
+		current_handle.Destroy();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	void Finish() {
+		FlushFrame();
+		FlushSegment(true);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	idx_t data_end;
+	vector<zstd_frame_entry_t> frames;
+
+	// State regarding the frame that is currently being filled
+	ZSTDCompressionContext context;
+	ZSTDFrameBuilder frame;
+	vector<bool> frame_validity;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.AddNull();
+		} else {
+			state.AddString(data[idx]);
+		}
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finish();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public StringScanState {
+	ZSTDScanState() : context(duckdb_zstd::ZSTD_createDCtx()), current_frame(DConstants::INVALID_INDEX) {
+		if (!context) {
+			throw InternalException("Failed to create ZSTD decompression context");
+		}
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_DCtx *context;
+	//! The frame directory of the segment
+	vector<zstd_frame_entry_t> frames;
+	//! The (segment-relative) row at which each frame starts
+	vector<idx_t> frame_starts;
+
+	//! The currently decompressed frame
+	idx_t current_frame;
+	buffer_ptr<VectorBuffer> frame_buffer;
+	//! The offsets of each string within the decompressed frame
+	vector<uint32_t> string_offsets;
+
+	idx_t FindFrame(idx_t row) const {
+		auto entry = std::upper_bound(frame_starts.begin(), frame_starts.end(), row);
+		D_ASSERT(entry != frame_starts.begin());
+		return NumericCast<idx_t>(entry - frame_starts.begin()) - 1;
+	}
+
+	void LoadFrame(data_ptr_t base_ptr, idx_t frame_idx) {
+		if (frame_idx == current_frame) {
+			return;
+		}
+		auto &frame = frames[frame_idx];
+		frame_buffer = make_buffer<VectorBuffer>(MaxValue<idx_t>(frame.uncompressed_size, 1));
+		auto decompressed_size =
+		    duckdb_zstd::ZSTD_decompressDCtx(context, frame_buffer->GetData(), frame.uncompressed_size,
+		                                     base_ptr + frame.data_offset, frame.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != frame.uncompressed_size) {
+			throw IOException("Failed to decompress ZSTD frame in column segment");
+		}
+
+		// compute the offsets of the strings within the frame
+		auto lengths = reinterpret_cast<uint32_t *>(frame_buffer->GetData());
+		string_offsets.resize(frame.row_count);
+		uint32_t offset = frame.row_count * sizeof(uint32_t);
+		for (idx_t i = 0; i < frame.row_count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(data_ptr_cast(lengths + i));
+		}
+		current_frame = frame_idx;
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	auto base_ptr = state->handle.Ptr() + segment.GetBlockOffset();
+
+	auto header_ptr = reinterpret_cast<zstd_segment_header_t *>(base_ptr);
+	auto frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+	auto directory_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->directory_offset));
+
+	state->frames.resize(frame_count);
+	state->frame_starts.resize(frame_count);
+	idx_t row_start = 0;
+	for (idx_t i = 0; i < frame_count; i++) {
+		auto entry_ptr = base_ptr + directory_offset + i * sizeof(zstd_frame_entry_t);
+		auto &frame = state->frames[i];
+		frame.data_offset = Load<uint32_t>(entry_ptr + offsetof(zstd_frame_entry_t, data_offset));
+		frame.compressed_size = Load<uint32_t>(entry_ptr + offsetof(zstd_frame_entry_t, compressed_size));
+		frame.uncompressed_size = Load<uint32_t>(entry_ptr + offsetof(zstd_frame_entry_t, uncompressed_size));
+		frame.row_count = Load<uint32_t>(entry_ptr + offsetof(zstd_frame_entry_t, row_count));
+		state->frame_starts[i] = row_start;
+		row_start += frame.row_count;
+	}
+	D_ASSERT(row_start == segment.count);
+	return std::move(state);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		auto frame_idx = scan_state.FindFrame(row);
+		scan_state.LoadFrame(base_ptr, frame_idx);
+
+		auto &frame = scan_state.frames[frame_idx];
+		auto frame_row = row - scan_state.frame_starts[frame_idx];
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, frame.row_count - frame_row);
+
+		// the strings point directly into the decompressed frame, which is kept alive by the result vector
+		auto frame_data = char_ptr_cast(scan_state.frame_buffer->GetData());
+		auto lengths = reinterpret_cast<uint32_t *>(scan_state.frame_buffer->GetData());
+		for (idx_t i = 0; i < to_scan; i++) {
+			auto length = Load<uint32_t>(data_ptr_cast(lengths + frame_row + i));
+			auto offset = scan_state.string_offsets[frame_row + i];
+			result_data[result_offset + scanned + i] = string_t(frame_data + offset, length);
+		}
+		StringVector::AddBuffer(result, scan_state.frame_buffer);
+		scanned += to_scan;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	// the scan state is kept in the fetch state, so fetching rows of the same frame only decompresses it once
+	auto &zstd_state = state.GetOrInsertScanState(segment).Cast<ZSTDScanState>();
+	auto base_ptr = zstd_state.handle.Ptr() + segment.GetBlockOffset();
+
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	auto frame_idx = zstd_state.FindFrame(row);
+	zstd_state.LoadFrame(base_ptr, frame_idx);
+
+	auto frame_row = row - zstd_state.frame_starts[frame_idx];
+	auto frame_data = char_ptr_cast(zstd_state.frame_buffer->GetData());
+	auto lengths = reinterpret_cast<uint32_t *>(zstd_state.frame_buffer->GetData());
+	auto length = Load<uint32_t>(data_ptr_cast(lengths + frame_row));
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] =
+	    StringVector::AddStringOrBlob(result, frame_data + zstd_state.string_offsets[frame_row], length);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	return CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+}
+
+bool ZSTDFun::TypeIsSupported(PhysicalType type) {
+	return type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -1363,6 +1363,12 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+void DataTable::RequestCompaction() {
+	row_groups->RequestCompaction();
+	// the compaction happens during the next checkpoint, which must not be skipped when the WAL is empty
+	StorageManager::Get(db).RequestCheckpoint();
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
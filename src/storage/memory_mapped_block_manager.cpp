@@ -0,0 +1,81 @@
+#include "duckdb/storage/memory_mapped_block_manager.hpp"
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/metadata/metadata_manager.hpp"
+
+namespace duckdb {
+
+//! A block that refers to the memory mapping of a database file, the memory is owned by the mapping
+class MappedBlock : public Block {
+public:
+	MappedBlock(Allocator &allocator, block_id_t id, data_ptr_t data) : Block(allocator, id, 0) {
+		internal_buffer = data;
+		internal_size = Storage::BLOCK_ALLOC_SIZE;
+		buffer = data + Storage::BLOCK_HEADER_SIZE;
+		size = Storage::BLOCK_SIZE;
+	}
+	~MappedBlock() override {
+		// prevent the FileBuffer from freeing the memory
+		internal_buffer = nullptr;
+	}
+};
+
+MemoryMappedBlockManager::MemoryMappedBlockManager(AttachedDatabase &db, string path, StorageManagerOptions options)
+    : SingleFileBlockManager(db, std::move(path), options), mapping(nullptr), mapping_size(0) {
+	D_ASSERT(options.read_only);
+}
+
+MemoryMappedBlockManager::~MemoryMappedBlockManager() {
+	if (!mapping) {
+		return;
+	}
+	try {
+		handle->file_system.UnmapFile(*handle, mapping, mapping_size);
+	} catch (...) { // NOLINT
+	}
+}
+
+void MemoryMappedBlockManager::LoadExistingDatabase() {
+	SingleFileBlockManager::LoadExistingDatabase();
+	auto file_size = handle->GetFileSize();
+	if (file_size <= NumericCast<int64_t>(BLOCK_START)) {
+		// the file has no blocks
+		return;
+	}
+	mapping_size = NumericCast<idx_t>(file_size);
+	mapping = handle->file_system.MapFile(*handle, mapping_size);
+	if (!mapping) {
+		// the file system does not support mapping the file: read the blocks instead
+		mapping_size = 0;
+		return;
+	}
+	verified_blocks.resize((mapping_size - BLOCK_START) / Storage::BLOCK_ALLOC_SIZE, false);
+}
+
+unique_ptr<Block> MemoryMappedBlockManager::MapBlock(block_id_t block_id) {
+	D_ASSERT(mapping);
+	D_ASSERT(block_id >= 0);
+	auto block_idx = NumericCast<idx_t>(block_id);
+	if (block_idx >= verified_blocks.size()) {
+		throw IOException("Could not read block %llu of database file \"%s\": the block is beyond the end of the file",
+		                  block_idx, path);
+	}
+	auto location = BLOCK_START + block_idx * Storage::BLOCK_ALLOC_SIZE;
+	auto block = make_uniq<MappedBlock>(buffer_manager.GetBufferAllocator(), block_id, mapping + location);
+	bool verified;
+	{
+		lock_guard<mutex> guard(verified_lock);
+		verified = verified_blocks[block_idx];
+	}
+	if (!verified) {
+		// the blocks do not change while the file is mapped: verify the checksum only once
+		VerifyBlockChecksums(*block, location, 1);
+		lock_guard<mutex> guard(verified_lock);
+		verified_blocks[block_idx] = true;
+	}
+	return std::move(block);
+}
+
+} // namespace duckdb
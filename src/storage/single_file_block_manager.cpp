@@ -39,12 +39,12 @@ void MainHeader::Write(WriteStream &ser) {
 	SerializeVersionNumber(ser, DuckDB::SourceID());
 }
 
-void MainHeader::CheckMagicBytes(FileHandle &handle) {
-	data_t magic_bytes[MAGIC_BYTE_SIZE];
-	if (handle.GetFileSize() < MainHeader::MAGIC_BYTE_SIZE + MainHeader::MAGIC_BYTE_OFFSET) {
+void MainHeader::CheckMagicBytes(FileHandle &handle, FileBuffer &header_buffer) {
+	if (handle.GetFileSize() < Storage::FILE_HEADER_SIZE) {
 		throw IOException("The file \"%s\" exists, but it is not a valid DuckDB database file!", handle.path);
 	}
-	handle.Read(magic_bytes, MainHeader::MAGIC_BYTE_SIZE, MainHeader::MAGIC_BYTE_OFFSET);
+	header_buffer.Read(handle, 0);
+	auto magic_bytes = header_buffer.InternalBuffer() + MainHeader::MAGIC_BYTE_OFFSET;
 	if (memcmp(magic_bytes, MainHeader::MAGIC_BYTES, MainHeader::MAGIC_BYTE_SIZE) != 0) {
 		throw IOException("The file \"%s\" exists, but it is not a valid DuckDB database file!", handle.path);
 	}
@@ -145,7 +145,7 @@ T DeserializeHeaderStructure(data_ptr_t ptr) {
 
 SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path_p, StorageManagerOptions options)
     : BlockManager(BufferManager::GetBufferManager(db)), db(db), path(std::move(path_p)),
-      header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
+      header_buffer(buffer_manager.GetIOAllocator(), FileBufferType::MANAGED_BUFFER,
                     Storage::FILE_HEADER_SIZE - Storage::BLOCK_HEADER_SIZE),
       iteration_count(0), options(options) {
 }
@@ -231,7 +231,7 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 		throw CatalogException("Cannot open database \"%s\" in read-only mode: database does not exist", path);
 	}
 
-	MainHeader::CheckMagicBytes(*handle);
+	MainHeader::CheckMagicBytes(*handle, header_buffer);
 	// otherwise, we check the metadata of the file
 	ReadAndChecksum(header_buffer, 0);
 	DeserializeHeaderStructure<MainHeader>(header_buffer.buffer);
@@ -405,7 +405,7 @@ unique_ptr<Block> SingleFileBlockManager::CreateBlock(block_id_t block_id, FileB
 	if (source_buffer) {
 		result = ConvertBlock(block_id, *source_buffer);
 	} else {
-		result = make_uniq<Block>(Allocator::Get(db), block_id);
+		result = make_uniq<Block>(buffer_manager.GetBlockAllocator(), block_id);
 	}
 	result->Initialize(options.debug_initialize);
 	return result;
@@ -417,6 +417,47 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, BLOCK_START + NumericCast<idx_t>(block.id) * Storage::BLOCK_ALLOC_SIZE);
 }
 
+void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
+	D_ASSERT(start_block >= 0);
+	D_ASSERT(block_count >= 1);
+	D_ASSERT(buffer.AllocSize() >= block_count * Storage::BLOCK_ALLOC_SIZE);
+	// read all blocks with a single read
+	auto location = BLOCK_START + NumericCast<idx_t>(start_block) * Storage::BLOCK_ALLOC_SIZE;
+	buffer.Read(*handle, location);
+	VerifyBlockChecksums(buffer, location, block_count);
+}
+
+void SingleFileBlockManager::ReadBlocks(vector<BlockRangeRead> &ranges) {
+	// issue the reads of all ranges as a single batch, so that the file system can have them in flight concurrently
+	vector<FileReadRequest> requests;
+	requests.reserve(ranges.size());
+	for (auto &range : ranges) {
+		D_ASSERT(range.start_block >= 0);
+		D_ASSERT(range.block_count >= 1);
+		D_ASSERT(range.buffer.AllocSize() >= range.block_count * Storage::BLOCK_ALLOC_SIZE);
+		auto location = BLOCK_START + NumericCast<idx_t>(range.start_block) * Storage::BLOCK_ALLOC_SIZE;
+		requests.emplace_back(range.buffer.InternalBuffer(), range.buffer.AllocSize(), location);
+	}
+	handle->ReadBatch(requests);
+	for (idx_t i = 0; i < ranges.size(); i++) {
+		VerifyBlockChecksums(ranges[i].buffer, requests[i].location, ranges[i].block_count);
+	}
+}
+
+void SingleFileBlockManager::VerifyBlockChecksums(FileBuffer &buffer, idx_t location, idx_t block_count) const {
+	auto block_ptr = buffer.InternalBuffer();
+	for (idx_t i = 0; i < block_count; i++) {
+		auto stored_checksum = Load<uint64_t>(block_ptr);
+		uint64_t computed_checksum = Checksum(block_ptr + Storage::BLOCK_HEADER_SIZE, Storage::BLOCK_SIZE);
+		if (stored_checksum != computed_checksum) {
+			throw IOException("Corrupt database file: computed checksum %llu does not match stored checksum %llu in "
+			                  "block at location %llu",
+			                  computed_checksum, stored_checksum, location + i * Storage::BLOCK_ALLOC_SIZE);
+		}
+		block_ptr += Storage::BLOCK_ALLOC_SIZE;
+	}
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	ChecksumAndWrite(buffer, BLOCK_START + NumericCast<idx_t>(block_id) * Storage::BLOCK_ALLOC_SIZE);
@@ -35,7 +35,14 @@ unique_ptr<FileBuffer> StandardBufferManager::ConstructManagedBuffer(idx_t size,
 		result = make_uniq<FileBuffer>(*tmp, type);
 	} else {
 		// no re-usable buffer: allocate a new buffer
-		result = make_uniq<FileBuffer>(Allocator::Get(db), type, size);
+		// tiny buffers are never written to disk, other buffers can be resized to a block and written to a temporary file
+		if (type == FileBufferType::TINY_BUFFER) {
+			result = make_uniq<FileBuffer>(Allocator::Get(db), type, size);
+		} else if (GetAllocSize(size) == Storage::BLOCK_ALLOC_SIZE) {
+			result = make_uniq<FileBuffer>(GetBlockAllocator(), type, size);
+		} else {
+			result = make_uniq<FileBuffer>(GetIOAllocator(), type, size);
+		}
 	}
 	result->Initialize(DBConfig::GetConfig(db).options.debug_initialize);
 	return result;
@@ -52,11 +59,14 @@ void StandardBufferManager::SetTemporaryDirectory(const string &new_dir) {
 StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
     : BufferManager(), db(db), buffer_pool(db.GetBufferPool()), temporary_id(MAXIMUM_BLOCK),
       buffer_allocator(BufferAllocatorAllocate, BufferAllocatorFree, BufferAllocatorRealloc,
-                       make_uniq<BufferAllocatorData>(*this)) {
+                       make_uniq<BufferAllocatorData>(*this)),
+      direct_io_allocator(DirectIOAllocatorAllocate, DirectIOAllocatorFree, DirectIOAllocatorRealloc,
+                          make_uniq<BufferAllocatorData>(*this)) {
 	temporary_directory.path = std::move(tmp);
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		evicted_data_per_tag[i] = 0;
+		evicted_data_on_disk_per_tag[i] = 0;
 	}
 }
 
@@ -71,6 +81,22 @@ TemporaryMemoryManager &StandardBufferManager::GetTemporaryMemoryManager() {
 	return buffer_pool.GetTemporaryMemoryManager();
 }
 
+Allocator &StandardBufferManager::GetBlockAllocator() {
+	auto &block_allocator = buffer_pool.GetBlockAllocator();
+	if (!block_allocator.IsEnabled()) {
+		return GetIOAllocator();
+	}
+	// the blocks of the block allocator are aligned to the block size
+	return block_allocator.GetAllocator();
+}
+
+Allocator &StandardBufferManager::GetIOAllocator() {
+	if (!DBConfig::GetConfig(db).options.use_direct_io) {
+		return Allocator::Get(db);
+	}
+	return direct_io_allocator;
+}
+
 idx_t StandardBufferManager::GetUsedMemory() const {
 	return buffer_pool.GetUsedMemory();
 }
@@ -185,6 +211,12 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
+	if (handle->IsMemoryMapped()) {
+		// the block is a view into a mapped file: it does not need any memory of the buffer pool
+		lock_guard<mutex> lock(handle->lock);
+		handle->readers++;
+		return handle->Load(handle);
+	}
 	idx_t required_memory;
 	{
 		// lock the block
@@ -192,6 +224,9 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			if (handle->readers == 0) {
+				handle->access_count++;
+			}
 			handle->readers++;
 			return handle->Load(handle);
 		}
@@ -207,6 +242,9 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// check if the block is already loaded
 	if (handle->state == BlockState::BLOCK_LOADED) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
+		if (handle->readers == 0) {
+			handle->access_count++;
+		}
 		handle->readers++;
 		reservation.Resize(0);
 		return handle->Load(handle);
@@ -214,6 +252,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// now we can actually load the current block
 	D_ASSERT(handle->readers == 0);
 	handle->readers = 1;
+	handle->access_count++;
 	auto buf = handle->Load(handle, std::move(reusable_buffer));
 	handle->memory_charge = std::move(reservation);
 	// In the case of a variable sized block, the buffer may be smaller than a full block.
@@ -237,7 +276,7 @@ void StandardBufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle)
 
 void StandardBufferManager::VerifyZeroReaders(shared_ptr<BlockHandle> &handle) {
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
-	auto replacement_buffer = make_uniq<FileBuffer>(Allocator::Get(db), handle->buffer->type,
+	auto replacement_buffer = make_uniq<FileBuffer>(handle->buffer->allocator, handle->buffer->type,
 	                                                handle->memory_usage - Storage::BLOCK_HEADER_SIZE);
 	memcpy(replacement_buffer->buffer, handle->buffer->buffer, handle->buffer->size);
 	WriteGarbageIntoBuffer(*handle->buffer);
@@ -254,7 +293,7 @@ void StandardBufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 		}
 		D_ASSERT(handle->readers > 0);
 		handle->readers--;
-		if (handle->readers == 0) {
+		if (handle->readers == 0 && !handle->IsMemoryMapped()) {
 			VerifyZeroReaders(handle);
 			purge = buffer_pool.AddToEvictionQueue(handle);
 		}
@@ -266,6 +305,114 @@ void StandardBufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 	}
 }
 
+idx_t StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	//! The maximum amount of blocks that are read with a single read
+	static constexpr const idx_t MAX_BATCH_BLOCKS = 32;
+
+	if (handles.empty()) {
+		return 0;
+	}
+	auto &block_manager = handles[0]->block_manager;
+	if (!block_manager.CanReadBlocks()) {
+		return 0;
+	}
+	// collect the persistent blocks that are not loaded yet, ordered by block id
+	map<block_id_t, idx_t> to_be_loaded;
+	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
+		auto &handle = handles[block_idx];
+		D_ASSERT(RefersToSameObject(handle->block_manager, block_manager));
+		if (handle->BlockId() >= MAXIMUM_BLOCK || !handle->IsUnloaded()) {
+			continue;
+		}
+		to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
+	}
+	// gather the runs of consecutive blocks, each run is read with a single read
+	vector<pair<block_id_t, idx_t>> runs;
+	for (auto &entry : to_be_loaded) {
+		auto block_id = entry.first;
+		if (!runs.empty()) {
+			auto &run = runs.back();
+			if (block_id == run.first + NumericCast<block_id_t>(run.second) && run.second < MAX_BATCH_BLOCKS) {
+				run.second++;
+				continue;
+			}
+		}
+		runs.emplace_back(block_id, 1);
+	}
+
+	// allocate the intermediate buffers of the runs - these are only alive during the read but they still count
+	// towards the memory limit
+	vector<TempBufferPoolReservation> read_reservations;
+	vector<unique_ptr<FileBuffer>> read_buffers;
+	vector<BlockRangeRead> ranges;
+	read_reservations.reserve(runs.size());
+	read_buffers.reserve(runs.size());
+	ranges.reserve(runs.size());
+	for (auto &run : runs) {
+		auto read_size = run.second * Storage::BLOCK_ALLOC_SIZE;
+		auto read_reservation = buffer_pool.EvictBlocks(MemoryTag::BASE_TABLE, read_size, buffer_pool.maximum_memory);
+		if (!read_reservation.success) {
+			break;
+		}
+		read_reservations.push_back(std::move(read_reservation.reservation));
+		read_buffers.push_back(make_uniq<FileBuffer>(GetIOAllocator(), FileBufferType::MANAGED_BUFFER,
+		                                             read_size - Storage::BLOCK_HEADER_SIZE));
+		ranges.emplace_back(*read_buffers.back(), run.first, run.second);
+	}
+	if (ranges.empty()) {
+		return 0;
+	}
+	// read all runs as a single batch, so that the reads can be in flight at the same time
+	block_manager.ReadBlocks(ranges);
+
+	idx_t loaded_count = 0;
+	for (auto &range : ranges) {
+		if (!LoadReadBlocks(handles, to_be_loaded, range, loaded_count)) {
+			break;
+		}
+	}
+	return loaded_count;
+}
+
+bool StandardBufferManager::LoadReadBlocks(vector<shared_ptr<BlockHandle>> &handles,
+                                           const map<block_id_t, idx_t> &load_map, BlockRangeRead &range,
+                                           idx_t &loaded_count) {
+	auto &read_buffer = range.buffer;
+	auto first_block = range.start_block;
+	auto block_count = range.block_count;
+
+	// load the individual blocks from the intermediate buffer
+	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+		auto entry = load_map.find(first_block + NumericCast<block_id_t>(block_idx));
+		D_ASSERT(entry != load_map.end());
+		auto &handle = handles[entry->second];
+
+		unique_ptr<FileBuffer> reusable_buffer;
+		auto reservation =
+		    buffer_pool.EvictBlocks(handle->tag, handle->memory_usage, buffer_pool.maximum_memory, &reusable_buffer);
+		if (!reservation.success) {
+			return false;
+		}
+		// the block is unpinned again when "buf" goes out of scope, which adds it to the eviction queue
+		// loading the block ahead of time is not an access of the block, so this does not count towards its reuse
+		BufferHandle buf;
+		{
+			lock_guard<mutex> lock(handle->lock);
+			if (handle->state == BlockState::BLOCK_LOADED) {
+				// the block was loaded in the meantime (e.g. by the scan itself)
+				continue;
+			}
+			D_ASSERT(handle->readers == 0);
+			handle->readers = 1;
+			auto block_data = read_buffer.InternalBuffer() + block_idx * Storage::BLOCK_ALLOC_SIZE;
+			buf = BlockHandle::LoadFromBuffer(handle, block_data, std::move(reusable_buffer));
+			handle->memory_charge = std::move(reservation.reservation);
+		}
+		loaded_count++;
+	}
+	return true;
+}
+
 void StandardBufferManager::SetMemoryLimit(idx_t limit) {
 	buffer_pool.SetLimit(limit, InMemoryWarning());
 }
@@ -286,6 +433,7 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.evicted_data_on_disk = evicted_data_on_disk_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -322,11 +470,13 @@ void StandardBufferManager::RequireTemporaryDirectory() {
 void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 	RequireTemporaryDirectory();
 	if (buffer.size == Storage::BLOCK_SIZE) {
+		auto size_on_disk = temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
 		evicted_data_per_tag[uint8_t(tag)] += Storage::BLOCK_SIZE;
-		temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
+		evicted_data_on_disk_per_tag[uint8_t(tag)] += size_on_disk;
 		return;
 	}
 	evicted_data_per_tag[uint8_t(tag)] += buffer.size;
+	evicted_data_on_disk_per_tag[uint8_t(tag)] += buffer.size;
 	// get the path to write to
 	auto path = GetTemporaryPath(block_id);
 	D_ASSERT(buffer.size > Storage::BLOCK_SIZE);
@@ -342,8 +492,12 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	D_ASSERT(!temporary_directory.path.empty());
 	D_ASSERT(temporary_directory.handle.get());
 	if (temporary_directory.handle->GetTempFile().HasTemporaryBuffer(id)) {
+		idx_t size_on_disk;
+		auto buffer =
+		    temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer), size_on_disk);
 		evicted_data_per_tag[uint8_t(tag)] -= Storage::BLOCK_SIZE;
-		return temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
+		evicted_data_on_disk_per_tag[uint8_t(tag)] -= size_on_disk;
+		return buffer;
 	}
 	idx_t block_size;
 	// open the temporary file and read the size
@@ -352,6 +506,7 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
 	handle->Read(&block_size, sizeof(idx_t), 0);
 	evicted_data_per_tag[uint8_t(tag)] -= block_size;
+	evicted_data_on_disk_per_tag[uint8_t(tag)] -= block_size;
 
 	// now allocate a buffer of this size and read the data into that buffer
 	auto buffer = ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t), block_size, std::move(reusable_buffer));
@@ -479,6 +634,38 @@ data_ptr_t StandardBufferManager::BufferAllocatorRealloc(PrivateAllocatorData *p
 	return Allocator::Get(data.manager.db).ReallocateData(pointer, old_size, size);
 }
 
+//! Direct I/O requires buffers that are aligned to the sector size. The direct I/O allocator over-allocates by a sector,
+//! and stores the offset of the aligned pointer in the allocation right before the aligned pointer.
+static constexpr const idx_t DIRECT_IO_ALLOCATION_OVERHEAD = Storage::SECTOR_SIZE + sizeof(idx_t);
+
+data_ptr_t StandardBufferManager::DirectIOAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size) {
+	auto &data = private_data->Cast<BufferAllocatorData>();
+	auto allocation = Allocator::Get(data.manager.db).AllocateData(size + DIRECT_IO_ALLOCATION_OVERHEAD);
+	auto address = CastPointerToValue(allocation) + sizeof(idx_t);
+	auto aligned_address = AlignValue<uintptr_t, Storage::SECTOR_SIZE>(address);
+	auto result = allocation + (aligned_address - address) + sizeof(idx_t);
+	Store<idx_t>(NumericCast<idx_t>(result - allocation), result - sizeof(idx_t));
+	return result;
+}
+
+void StandardBufferManager::DirectIOAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+	auto &data = private_data->Cast<BufferAllocatorData>();
+	auto offset = Load<idx_t>(pointer - sizeof(idx_t));
+	Allocator::Get(data.manager.db).FreeData(pointer - offset, size + DIRECT_IO_ALLOCATION_OVERHEAD);
+}
+
+data_ptr_t StandardBufferManager::DirectIOAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer,
+                                                           idx_t old_size, idx_t size) {
+	if (old_size == size) {
+		return pointer;
+	}
+	// the underlying allocator does not preserve the alignment: allocate a new buffer and copy the data over
+	auto result = DirectIOAllocatorAllocate(private_data, size);
+	memcpy(result, pointer, MinValue<idx_t>(old_size, size));
+	DirectIOAllocatorFree(private_data, pointer, old_size);
+	return result;
+}
+
 Allocator &BufferAllocator::Get(ClientContext &context) {
 	auto &manager = StandardBufferManager::GetBufferManager(context);
 	return manager.GetBufferAllocator();
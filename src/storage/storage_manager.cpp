@@ -1,6 +1,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/checkpoint_manager.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
+#include "duckdb/storage/memory_mapped_block_manager.hpp"
 #include "duckdb/storage/single_file_block_manager.hpp"
 #include "duckdb/storage/object_cache.hpp"
 
@@ -17,7 +18,7 @@
 namespace duckdb {
 
 StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only)
-    : db(db), path(std::move(path_p)), read_only(read_only) {
+    : db(db), path(std::move(path_p)), read_only(read_only), checkpoint_requested(false) {
 	if (path.empty()) {
 		path = IN_MEMORY_PATH;
 	} else {
@@ -87,6 +88,10 @@ bool StorageManager::InMemory() {
 	return path == IN_MEMORY_PATH;
 }
 
+void StorageManager::RequestCheckpoint() {
+	checkpoint_requested = true;
+}
+
 void StorageManager::Initialize(optional_ptr<ClientContext> context) {
 	bool in_memory = InMemory();
 	if (in_memory && read_only) {
@@ -164,7 +169,12 @@ void SingleFileStorageManager::LoadDatabase(optional_ptr<ClientContext> context)
 		// try to read the existing file on disk
 
 		// initialize the block manager while loading the current db file
-		auto sf_block_manager = make_uniq<SingleFileBlockManager>(db, path, options);
+		unique_ptr<SingleFileBlockManager> sf_block_manager;
+		if (read_only && config.options.mmap_read_only) {
+			sf_block_manager = make_uniq<MemoryMappedBlockManager>(db, path, options);
+		} else {
+			sf_block_manager = make_uniq<SingleFileBlockManager>(db, path, options);
+		}
 		sf_block_manager->LoadExistingDatabase();
 		block_manager = std::move(sf_block_manager);
 		table_io_manager = make_uniq<SingleFileTableIOManager>(*block_manager);
@@ -263,8 +273,9 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 	}
 	auto &config = DBConfig::Get(db);
 	if (wal->GetWALSize() > 0 || config.options.force_checkpoint ||
-	    options.action == CheckpointAction::FORCE_CHECKPOINT) {
-		// we only need to checkpoint if there is anything in the WAL
+	    options.action == CheckpointAction::FORCE_CHECKPOINT || checkpoint_requested) {
+		// we only need to checkpoint if there is anything in the WAL, or if a checkpoint was requested
+		checkpoint_requested = false;
 		try {
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
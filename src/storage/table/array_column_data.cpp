@@ -173,6 +173,15 @@ void ArrayColumnData::CommitDropColumn() {
 	child_column->CommitDropColumn();
 }
 
+bool ArrayColumnData::HasChanges() {
+	return validity.HasChanges() || child_column->HasChanges();
+}
+
+void ArrayColumnData::InitializePrefetch(PrefetchState &prefetch_state) {
+	validity.InitializePrefetch(prefetch_state);
+	child_column->InitializePrefetch(prefetch_state);
+}
+
 struct ArrayColumnCheckpointState : public ColumnCheckpointState {
 	ArrayColumnCheckpointState(RowGroup &row_group, ColumnData &column_data, PartialBlockManager &partial_block_manager)
 	    : ColumnCheckpointState(row_group, column_data, partial_block_manager) {
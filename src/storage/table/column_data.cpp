@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -113,8 +114,8 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		idx_t result_offset = initial_remaining - remaining;
 		if (scan_count > 0) {
 			if (state.scan_options && state.scan_options->force_fetch_row) {
+				ColumnFetchState fetch_state;
 				for (idx_t i = 0; i < scan_count; i++) {
-					ColumnFetchState fetch_state;
 					state.current->FetchRow(fetch_state, UnsafeNumericCast<row_t>(state.row_index + i), result,
 					                        result_offset + i);
 				}
@@ -176,6 +177,11 @@ void ColumnData::FetchUpdateRow(TransactionData transaction, row_t row_id, Vecto
 
 void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
                                 idx_t update_count, Vector &base_vector) {
+	{
+		// the updated values are not part of the bloom filter
+		lock_guard<mutex> l(stats_lock);
+		bloom_filter.reset();
+	}
 	lock_guard<mutex> update_guard(update_lock);
 	if (!updates) {
 		updates = make_uniq<UpdateSegment>(*this);
@@ -243,6 +249,45 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, s_count);
 }
 
+bool ColumnData::ScanVectorFiltered(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                    idx_t &approved_tuple_count, const TableFilter &filter, idx_t &scan_count) {
+	if (!state.current || HasUpdates() || (state.scan_options && state.scan_options->force_fetch_row)) {
+		return false;
+	}
+	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
+	auto vector_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - current_row);
+	if (state.initialized && state.row_index == state.current->start + state.current->count) {
+		// we have exhausted the current segment - move to the next one
+		auto next = data.GetNextSegment(state.current);
+		if (!next) {
+			return false;
+		}
+		state.current = next;
+		state.initialized = false;
+		state.segment_checked = false;
+	}
+	auto &segment = *state.current;
+	if (state.row_index + vector_count > segment.start + segment.count || !segment.SupportsFilter(filter)) {
+		// the vector crosses a segment boundary or the segment cannot evaluate the filter
+		return false;
+	}
+	state.previous_states.clear();
+	if (!state.initialized) {
+		segment.InitializeScan(state);
+		state.internal_index = segment.start;
+		state.initialized = true;
+	}
+	D_ASSERT(state.internal_index <= state.row_index);
+	if (state.internal_index < state.row_index) {
+		segment.Skip(state);
+	}
+	segment.Filter(state, vector_count, result, sel, approved_tuple_count, filter);
+	state.row_index += vector_count;
+	state.internal_index = state.row_index;
+	scan_count = vector_count;
+	return true;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t s_count) {
 	Scan(transaction, vector_index, state, result);
@@ -270,6 +315,8 @@ void ColumnData::Append(ColumnAppendState &state, Vector &vector, idx_t append_c
 		throw InternalException("ColumnData::Append called on a column with a parent or without stats");
 	}
 	lock_guard<mutex> l(stats_lock);
+	// the appended values are not part of the bloom filter
+	bloom_filter.reset();
 	Append(stats->statistics, state, vector, append_count);
 }
 
@@ -283,6 +330,9 @@ bool ColumnData::CheckZonemap(TableFilter &filter) {
 	    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
 		return false;
 	}
+	if (bloom_filter && !filter.CheckBloomFilter(*bloom_filter)) {
+		return false;
+	}
 	return true;
 }
 
@@ -302,6 +352,16 @@ void ColumnData::MergeStatistics(const BaseStatistics &other) {
 	return stats->statistics.Merge(other);
 }
 
+shared_ptr<BloomFilter> ColumnData::GetBloomFilter() {
+	lock_guard<mutex> l(stats_lock);
+	return bloom_filter;
+}
+
+void ColumnData::SetBloomFilter(shared_ptr<BloomFilter> filter) {
+	lock_guard<mutex> l(stats_lock);
+	bloom_filter = std::move(filter);
+}
+
 void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 	if (!stats) {
 		throw InternalException("ColumnData::MergeIntoStatistics called on a column without stats");
@@ -443,6 +503,29 @@ void ColumnData::CommitDropColumn() {
 	}
 }
 
+bool ColumnData::HasChanges() {
+	if (ColumnData::HasUpdates()) {
+		return true;
+	}
+	for (auto &segment : data.Segments()) {
+		if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+			// transient segment: the data has not been written to disk yet
+			return true;
+		}
+	}
+	return false;
+}
+
+void ColumnData::InitializePrefetch(PrefetchState &prefetch_state) {
+	for (auto &segment : data.Segments()) {
+		if (segment.segment_type != ColumnSegmentType::PERSISTENT || !segment.block) {
+			// transient and constant segments are not read from disk
+			continue;
+		}
+		prefetch_state.AddBlock(segment.block);
+	}
+}
+
 unique_ptr<ColumnCheckpointState> ColumnData::CreateCheckpointState(RowGroup &row_group,
                                                                     PartialBlockManager &partial_block_manager) {
 	return make_uniq<ColumnCheckpointState>(row_group, *this, partial_block_manager);
@@ -451,8 +534,8 @@ unique_ptr<ColumnCheckpointState> ColumnData::CreateCheckpointState(RowGroup &ro
 void ColumnData::CheckpointScan(ColumnSegment &segment, ColumnScanState &state, idx_t row_group_start, idx_t count,
                                 Vector &scan_vector) {
 	if (state.scan_options && state.scan_options->force_fetch_row) {
+		ColumnFetchState fetch_state;
 		for (idx_t i = 0; i < count; i++) {
-			ColumnFetchState fetch_state;
 			segment.FetchRow(fetch_state, UnsafeNumericCast<row_t>(state.row_index + i), scan_vector, i);
 		}
 	} else {
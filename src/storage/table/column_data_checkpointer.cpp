@@ -1,5 +1,7 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -197,13 +199,72 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	// while compressing, collect the hashes of the values if we are building a bloom filter
+	auto build_bloom_filter = ShouldBuildBloomFilter();
+	vector<hash_t> hashes;
+	Vector hash_vector(LogicalType::HASH);
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		best_function->compress(*compress_state, scan_vector, count);
+		if (!build_bloom_filter) {
+			return;
+		}
+		VectorOperations::Hash(scan_vector, hash_vector, count);
+		UnifiedVectorFormat vdata;
+		scan_vector.ToUnifiedFormat(count, vdata);
+		auto hash_data = FlatVector::GetData<hash_t>(hash_vector);
+		for (idx_t i = 0; i < count; i++) {
+			if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+				hashes.push_back(hash_data[i]);
+			}
+		}
+	});
 	best_function->compress_finalize(*compress_state);
+	if (build_bloom_filter) {
+		CreateBloomFilter(hashes);
+	}
 
 	nodes.clear();
 }
 
+bool ColumnDataCheckpointer::ShouldBuildBloomFilter() {
+	if (!col_data.stats) {
+		// bloom filters are only kept for top-level columns
+		return false;
+	}
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	if (!config.options.enable_row_group_bloom_filters) {
+		return false;
+	}
+	switch (GetType().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void ColumnDataCheckpointer::CreateBloomFilter(vector<hash_t> &hashes) {
+	// size the filter based on the number of distinct values in the row group
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+	auto bloom_filter = make_shared_ptr<BloomFilter>(BloomFilter::BlockCount(hashes.size(), BLOOM_FILTER_BITS_PER_KEY));
+	bloom_filter->Insert(hashes.data(), hashes.size());
+	col_data.SetBloomFilter(std::move(bloom_filter));
+}
+
 bool ColumnDataCheckpointer::HasChanges() {
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
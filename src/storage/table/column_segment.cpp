@@ -7,6 +7,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -128,6 +129,55 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+void ColumnSegment::Filter(ColumnScanState &state, idx_t vector_count, Vector &result, SelectionVector &sel,
+                           idx_t &approved_tuple_count, const TableFilter &filter) {
+	D_ASSERT(function.get().filter);
+	function.get().filter(*this, state, vector_count, result, sel, approved_tuple_count, filter);
+}
+
+static bool FilterHasComparison(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::IS_NOT_NULL:
+		return false;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = filter.Cast<ConjunctionAndFilter>();
+		bool has_comparison = false;
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (child_filter->filter_type == TableFilterType::IS_NOT_NULL) {
+				continue;
+			}
+			if (!FilterHasComparison(*child_filter)) {
+				return false;
+			}
+			has_comparison = true;
+		}
+		return has_comparison;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (!FilterHasComparison(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ColumnSegment::SupportsFilter(const TableFilter &filter) const {
+	if (!function.get().filter) {
+		return false;
+	}
+	// the compressed data has no notion of NULL values: only prune with filters that NULL values can never pass
+	return FilterHasComparison(filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -333,6 +383,52 @@ static void FilterSelectionSwitch(UnifiedVectorFormat &vdata, T predicate, Selec
 	sel.Initialize(new_sel);
 }
 
+template <class T, bool HAS_NULL>
+static idx_t TemplatedInSelection(UnifiedVectorFormat &vdata, const T *constants, idx_t constant_count,
+                                  const SelectionVector &sel, idx_t approved_tuple_count, SelectionVector &result_sel) {
+	auto &mask = vdata.validity;
+	auto vec = UnifiedVectorFormat::GetData<T>(vdata);
+	// the constants are sorted: values outside of [min, max] can be rejected without probing
+	auto &min_constant = constants[0];
+	auto &max_constant = constants[constant_count - 1];
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (HAS_NULL && !mask.RowIsValid(vector_idx)) {
+			continue;
+		}
+		auto &value = vec[vector_idx];
+		if (LessThan::Operation(value, min_constant) || GreaterThan::Operation(value, max_constant)) {
+			continue;
+		}
+		if (InFilter::Contains<T>(constants, constant_count, value)) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	return result_count;
+}
+
+template <class T>
+static void InSelectionSwitch(UnifiedVectorFormat &vdata, const InFilter &filter, SelectionVector &sel,
+                              idx_t &approved_tuple_count) {
+	if (filter.values.empty()) {
+		approved_tuple_count = 0;
+		return;
+	}
+	auto constants = FlatVector::GetData<T>(filter.sorted_values);
+	auto constant_count = filter.values.size();
+	SelectionVector new_sel(approved_tuple_count);
+	if (vdata.validity.AllValid()) {
+		approved_tuple_count =
+		    TemplatedInSelection<T, false>(vdata, constants, constant_count, sel, approved_tuple_count, new_sel);
+	} else {
+		approved_tuple_count =
+		    TemplatedInSelection<T, true>(vdata, constants, constant_count, sel, approved_tuple_count, new_sel);
+	}
+	sel.Initialize(new_sel);
+}
+
 template <bool IS_NULL>
 static idx_t TemplatedNullSelection(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) {
 	auto &mask = vdata.validity;
@@ -488,6 +584,56 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		}
 		return approved_tuple_count;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		switch (vector.GetType().InternalType()) {
+		case PhysicalType::UINT8:
+			InSelectionSwitch<uint8_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT16:
+			InSelectionSwitch<uint16_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT32:
+			InSelectionSwitch<uint32_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT64:
+			InSelectionSwitch<uint64_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT128:
+			InSelectionSwitch<uhugeint_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT8:
+			InSelectionSwitch<int8_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT16:
+			InSelectionSwitch<int16_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT32:
+			InSelectionSwitch<int32_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT64:
+			InSelectionSwitch<int64_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT128:
+			InSelectionSwitch<hugeint_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::FLOAT:
+			InSelectionSwitch<float>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::DOUBLE:
+			InSelectionSwitch<double>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::VARCHAR:
+			InSelectionSwitch<string_t>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		case PhysicalType::BOOL:
+			InSelectionSwitch<bool>(vdata, in_filter, sel, approved_tuple_count);
+			break;
+		default:
+			throw InvalidTypeException(vector.GetType(), "Invalid type for IN filter pushed down to table comparison");
+		}
+		return approved_tuple_count;
+	}
 	case TableFilterType::IS_NULL:
 		return TemplatedNullSelection<true>(vdata, sel, approved_tuple_count);
 	case TableFilterType::IS_NOT_NULL:
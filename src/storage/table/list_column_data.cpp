@@ -308,6 +308,16 @@ void ListColumnData::CommitDropColumn() {
 	child_column->CommitDropColumn();
 }
 
+bool ListColumnData::HasChanges() {
+	return ColumnData::HasChanges() || validity.HasChanges() || child_column->HasChanges();
+}
+
+void ListColumnData::InitializePrefetch(PrefetchState &prefetch_state) {
+	ColumnData::InitializePrefetch(prefetch_state);
+	validity.InitializePrefetch(prefetch_state);
+	child_column->InitializePrefetch(prefetch_state);
+}
+
 struct ListColumnCheckpointState : public ColumnCheckpointState {
 	ListColumnCheckpointState(RowGroup &row_group, ColumnData &column_data, PartialBlockManager &partial_block_manager)
 	    : ColumnCheckpointState(row_group, column_data, partial_block_manager) {
@@ -10,6 +10,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
+#include "duckdb/storage/metadata/metadata_writer.hpp"
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -49,11 +50,17 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 }
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
+	bool metadata_changed = new_start != start || !RefersToSameObject(collection_p, collection.get());
 	this->collection = collection_p;
 	this->start = new_start;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
 	}
+	if (metadata_changed) {
+		// the row start is part of the column metadata - it has to be rewritten on the next checkpoint
+		column_pointers.clear();
+		column_metadata_blocks.clear();
+	}
 	if (!HasUnloadedDeletes()) {
 		auto &vinfo = GetVersionInfo();
 		if (vinfo) {
@@ -99,9 +106,11 @@ ColumnData &RowGroup::GetColumn(storage_t c) {
 	auto &metadata_manager = GetCollection().GetMetadataManager();
 	auto &types = GetCollection().GetTypes();
 	auto &block_pointer = column_pointers[c];
-	MetadataReader column_data_reader(metadata_manager, block_pointer);
+	vector<MetaBlockPointer> read_pointers;
+	MetadataReader column_data_reader(metadata_manager, block_pointer, &read_pointers);
 	this->columns[c] =
 	    ColumnData::Deserialize(GetBlockManager(), GetTableInfo(), c, start, column_data_reader, types[c]);
+	column_metadata_blocks.insert(column_metadata_blocks.end(), read_pointers.begin(), read_pointers.end());
 	is_loaded[c] = true;
 	if (this->columns[c]->count != this->count) {
 		throw InternalException("Corrupted database - loaded column with index %llu at row start %llu, count %llu did "
@@ -171,11 +180,38 @@ void CollectionScanState::Initialize(const vector<LogicalType> &types) {
 	}
 }
 
+void RowGroup::InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state) {
+	auto &column_ids = state.GetColumnIds();
+	auto filters = state.GetFilters();
+	if (filters && !CheckZonemap(*filters, column_ids)) {
+		// the scan skips this row group
+		return;
+	}
+	for (auto &column : column_ids) {
+		if (column == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		GetColumn(column).InitializePrefetch(prefetch_state);
+	}
+}
+
+void RowGroup::InitializeReadAhead(CollectionScanState &state) {
+	auto depth = state.GetOptions().read_ahead_depth;
+	if (depth == 0) {
+		return;
+	}
+	if (!state.read_ahead) {
+		state.read_ahead = make_uniq<RowGroupReadAhead>(GetCollection().GetAttached().GetDatabase());
+	}
+	state.read_ahead->EnterRowGroup(*this, state, depth);
+}
+
 bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset) {
 	auto &column_ids = state.GetColumnIds();
 	auto filters = state.GetFilters();
 	if (filters) {
 		if (!CheckZonemap(*filters, column_ids)) {
+			state.pruned_row_groups++;
 			return false;
 		}
 	}
@@ -189,6 +225,9 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 		// exceeded row groups to scan
 		return false;
 	}
+	if (vector_offset == 0) {
+		InitializeReadAhead(state);
+	}
 	D_ASSERT(state.column_scans);
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		const auto &column = column_ids[i];
@@ -208,6 +247,7 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	auto filters = state.GetFilters();
 	if (filters) {
 		if (!CheckZonemap(*filters, column_ids)) {
+			state.pruned_row_groups++;
 			return false;
 		}
 	}
@@ -218,6 +258,7 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	if (state.max_row_group_row == 0) {
 		return false;
 	}
+	InitializeReadAhead(state);
 	D_ASSERT(state.column_scans);
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
@@ -397,6 +438,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -859,26 +901,65 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
 
+	auto &metadata_manager = writer.GetPayloadWriter().GetManager();
+	if (RefersToSameObject(metadata_manager, GetCollection().GetMetadataManager()) && !HasChanges()) {
+		// the row group has not changed since it was last written: skip writing it entirely
+		RowGroupWriteData result;
+		result.reuse_existing_metadata = true;
+		return result;
+	}
+
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
 
+bool RowGroup::HasChanges() {
+	if (column_pointers.empty()) {
+		// the row group has not been written to disk in its current form
+		return true;
+	}
+	// load all columns - this also collects the metadata blocks they occupy
+	for (auto &column : GetColumns()) {
+		if (column->HasChanges()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
                                      TableStatistics &global_stats) {
 	RowGroupPointer row_group_pointer;
+	row_group_pointer.row_start = start;
+	row_group_pointer.tuple_count = count;
 
+	auto &metadata_manager = writer.GetPayloadWriter().GetManager();
 	auto lock = global_stats.GetLock();
+	if (write_data.reuse_existing_metadata) {
+		// the row group is unchanged: point to the existing column metadata
+		for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+			global_stats.GetStats(*lock, column_idx).Statistics().Merge(*GetStatistics(column_idx));
+		}
+		// ensure the blocks we are pointing to are not marked as free
+		metadata_manager.ClearModifiedBlocks(column_metadata_blocks);
+		row_group_pointer.data_pointers = column_pointers;
+		row_group_pointer.deletes_pointers = CheckpointDeletes(metadata_manager);
+		Verify();
+		return row_group_pointer;
+	}
+
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
 		global_stats.GetStats(*lock, column_idx).Statistics().Merge(write_data.statistics[column_idx]);
 	}
 
 	// construct the row group pointer and write the column meta data to disk
+	// the column metadata of every row group is written to its own chain of metadata blocks
+	// this allows subsequent checkpoints to re-use it as-is if the row group is not modified
 	D_ASSERT(write_data.states.size() == columns.size());
-	row_group_pointer.row_start = start;
-	row_group_pointer.tuple_count = count;
+	vector<MetaBlockPointer> written_blocks;
+	MetadataWriter data_writer(metadata_manager, &written_blocks);
 	for (auto &state : write_data.states) {
-		// get the current position of the table data writer
-		auto &data_writer = writer.GetPayloadWriter();
+		// get the current position of the column data writer
 		auto pointer = data_writer.GetMetaBlockPointer();
 
 		// store the stats and the data pointers in the row group pointers
@@ -893,6 +974,10 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		state->WriteDataPointers(writer, serializer);
 		serializer.End();
 	}
+	data_writer.Flush();
+	column_pointers = row_group_pointer.data_pointers;
+	column_metadata_blocks = std::move(written_blocks);
+
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
 	Verify();
 	return row_group_pointer;
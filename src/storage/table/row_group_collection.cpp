@@ -14,6 +14,8 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
 
@@ -54,7 +56,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), compaction_requested(false), allocation_size(0) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -727,6 +729,8 @@ private:
 //===--------------------------------------------------------------------===//
 struct VacuumState {
 	bool can_vacuum_deletes = false;
+	//! Whether every row group with deleted rows is rewritten, instead of only row groups with many deleted rows
+	bool vacuum_all_deletes = false;
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
@@ -852,8 +856,13 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 	// currently we can only vacuum deletes if we are doing a full checkpoint and there are no indexes
 	state.can_vacuum_deletes = info->GetIndexes().Empty() && is_full_checkpoint;
 	if (!state.can_vacuum_deletes) {
+		if (!info->GetIndexes().Empty()) {
+			// an index was created after the compaction was requested: the compaction can never be performed
+			compaction_requested = false;
+		}
 		return;
 	}
+	state.vacuum_all_deletes = compaction_requested;
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
@@ -871,6 +880,8 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                              idx_t segment_idx) {
 	static constexpr const idx_t MAX_MERGE_COUNT = 3;
+	//! The fraction of deleted rows at which a row group that cannot be merged is rewritten by itself
+	static constexpr const double DELETED_ROWS_THRESHOLD = 0.2;
 
 	if (!state.can_vacuum_deletes) {
 		// we cannot vacuum deletes - cannot vacuum
@@ -920,7 +931,22 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		// we cannot merge - but if a large fraction of this row group is deleted we rewrite it by itself
+		// this compacts the deleted rows, so scans no longer need to process them
+		auto &row_group = *checkpoint_state.segments[segment_idx].node;
+		auto row_group_count = row_group.count.load();
+		auto deleted_rows = row_group_count - state.row_group_counts[segment_idx];
+		if (deleted_rows == 0) {
+			return false;
+		}
+		if (!state.vacuum_all_deletes &&
+		    static_cast<double>(deleted_rows) < static_cast<double>(row_group_count) * DELETED_ROWS_THRESHOLD) {
+			return false;
+		}
+		merge_rows = state.row_group_counts[segment_idx];
+		merge_count = 1;
+		target_count = 1;
+		next_idx = segment_idx + 1;
 	}
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
@@ -932,6 +958,152 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	return true;
 }
 
+//===--------------------------------------------------------------------===//
+// Sort
+//===--------------------------------------------------------------------===//
+void RowGroupCollection::SortRowGroups(CollectionCheckpointState &checkpoint_state, VacuumState &state,
+                                       const vector<PhysicalIndex> &sort_key) {
+	D_ASSERT(state.can_vacuum_deletes);
+	auto &segments = checkpoint_state.segments;
+	// row groups before the first changed row group were sorted by a previous checkpoint - they are left untouched
+	// only the changed tail of the table is sorted, which keeps checkpoints after small appends cheap
+	idx_t sort_start = segments.size();
+	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
+		auto &entry = segments[segment_idx];
+		if (entry.node && entry.node->HasChanges()) {
+			sort_start = segment_idx;
+			break;
+		}
+	}
+	if (sort_start == segments.size()) {
+		return;
+	}
+	auto &buffer_manager = block_manager.buffer_manager;
+
+	// sort on the sort key columns - the payload consists of all columns of the table
+	vector<BoundOrderByNode> orders;
+	vector<LogicalType> key_types;
+	for (auto &key : sort_key) {
+		auto &key_type = types[key.index];
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(key_type, key.index));
+		key_types.push_back(key_type);
+	}
+	RowLayout payload_layout;
+	payload_layout.Initialize(types);
+	GlobalSortState global_sort(buffer_manager, orders, payload_layout);
+	LocalSortState local_sort;
+	local_sort.Initialize(global_sort, buffer_manager);
+	auto memory_limit = buffer_manager.GetMaxMemory() / 4;
+
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
+	DataChunk key_chunk;
+	key_chunk.InitializeEmpty(key_types);
+
+	vector<column_t> column_ids;
+	for (idx_t c = 0; c < types.size(); c++) {
+		column_ids.push_back(c);
+	}
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	scan_state.table_state.Initialize(types);
+	scan_state.table_state.max_row = idx_t(-1);
+
+	// sink the committed rows of the tail into the sort, and drop the original row groups
+	idx_t sort_count = 0;
+	for (idx_t segment_idx = sort_start; segment_idx < segments.size(); segment_idx++) {
+		auto &entry = segments[segment_idx];
+		if (!entry.node) {
+			continue;
+		}
+		auto &row_group = *entry.node;
+		row_group.InitializeScan(scan_state.table_state);
+		while (true) {
+			scan_chunk.Reset();
+			row_group.ScanCommitted(scan_state.table_state, scan_chunk,
+			                        TableScanType::TABLE_SCAN_LATEST_COMMITTED_ROWS);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			for (idx_t k = 0; k < sort_key.size(); k++) {
+				key_chunk.data[k].Reference(scan_chunk.data[sort_key[k].index]);
+			}
+			key_chunk.SetCardinality(scan_chunk);
+			local_sort.SinkChunk(key_chunk, scan_chunk);
+			if (local_sort.SizeInBytes() >= memory_limit) {
+				// the data does not comfortably fit in memory - sort what we have and switch to an external sort
+				global_sort.external = true;
+				local_sort.Sort(global_sort, true);
+			}
+			sort_count += scan_chunk.size();
+		}
+		row_group.CommitDrop();
+		entry.node.reset();
+		state.row_group_counts[segment_idx] = 0;
+	}
+	if (sort_count == 0) {
+		return;
+	}
+	global_sort.AddLocalState(local_sort);
+	global_sort.PrepareMergePhase();
+	while (global_sort.sorted_blocks.size() > 1) {
+		global_sort.InitializeMergeRound();
+		MergeSorter merge_sorter(global_sort, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_sort.CompleteMergeRound(false);
+	}
+
+	// write the sorted rows into new (full) row groups
+	// these always fit in the slots of the row groups they replace, as each of those held at most a full row group
+	vector<unique_ptr<RowGroup>> new_row_groups;
+	for (idx_t remaining = sort_count; remaining > 0;) {
+		auto row_group_rows = MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE);
+		auto new_row_group = make_uniq<RowGroup>(*this, 0, row_group_rows);
+		new_row_group->InitializeEmpty(types);
+		new_row_groups.push_back(std::move(new_row_group));
+		remaining -= row_group_rows;
+	}
+	D_ASSERT(sort_start + new_row_groups.size() <= segments.size());
+
+	idx_t current_append_idx = 0;
+	idx_t current_append_count = 0;
+	TableAppendState append_state;
+	new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+
+	PayloadScanner scanner(global_sort);
+	DataChunk sorted_chunk;
+	sorted_chunk.Initialize(Allocator::DefaultAllocator(), types);
+	while (scanner.Remaining()) {
+		sorted_chunk.Reset();
+		scanner.Scan(sorted_chunk);
+		idx_t remaining = sorted_chunk.size();
+		while (remaining > 0) {
+			if (current_append_count == Storage::ROW_GROUP_SIZE) {
+				// move to the next row group
+				current_append_idx++;
+				current_append_count = 0;
+				new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+			}
+			idx_t append_count = MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - current_append_count);
+			new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, sorted_chunk,
+			                                           append_count);
+			current_append_count += append_count;
+			remaining -= append_count;
+			if (remaining > 0) {
+				// slice chunk for the next append
+				sorted_chunk.Slice(append_count, remaining);
+			}
+		}
+	}
+	for (idx_t i = 0; i < new_row_groups.size(); i++) {
+		auto &row_group = new_row_groups[i];
+		row_group->Verify();
+		state.row_group_counts[sort_start + i] = row_group->count;
+		segments[sort_start + i].node = std::move(row_group);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -948,6 +1120,12 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 
 	VacuumState vacuum_state;
 	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	auto sort_key = writer.GetSortKeyColumns();
+	if (vacuum_state.can_vacuum_deletes && !sort_key.empty()) {
+		// the table has a sort key: sort the changed row groups before they are written
+		// this requires the same conditions as vacuuming, as the row ids of the sorted rows change
+		SortRowGroups(checkpoint_state, vacuum_state, sort_key);
+	}
 	// schedule tasks
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
@@ -979,6 +1157,10 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		checkpoint_state.CancelTasks();
 		checkpoint_state.ThrowError();
 	}
+	if (vacuum_state.can_vacuum_deletes) {
+		// any requested compaction has been performed
+		compaction_requested = false;
+	}
 
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
@@ -1168,4 +1350,8 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
+void RowGroupCollection::RequestCompaction() {
+	compaction_requested = true;
+}
+
 } // namespace duckdb
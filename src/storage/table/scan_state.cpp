@@ -5,6 +5,9 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table/row_group_collection.hpp"
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -55,6 +58,17 @@ void ColumnScanState::Next(idx_t count) {
 	}
 }
 
+SegmentScanState &ColumnFetchState::GetOrInsertScanState(ColumnSegment &segment) {
+	auto entry = scan_states.find(&segment);
+	if (entry != scan_states.end()) {
+		return *entry->second;
+	}
+	auto scan_state = segment.function.get().init_scan(segment);
+	auto &result = *scan_state;
+	scan_states.insert(make_pair(&segment, std::move(scan_state)));
+	return result;
+}
+
 const vector<storage_t> &CollectionScanState::GetColumnIds() {
 	return parent.GetColumnIds();
 }
@@ -75,9 +89,91 @@ ParallelCollectionScanState::ParallelCollectionScanState()
     : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
 }
 
+void PrefetchState::AddBlock(shared_ptr<BlockHandle> block) {
+	if (!block_ids.insert(block->BlockId()).second) {
+		// multiple segments can share the same block
+		return;
+	}
+	blocks.push_back(std::move(block));
+}
+
+class RowGroupReadAheadTask : public Task {
+public:
+	RowGroupReadAheadTask(BufferManager &buffer_manager, atomic<idx_t> &pending_tasks, atomic<idx_t> &hits,
+	                      vector<shared_ptr<BlockHandle>> blocks_p)
+	    : buffer_manager(buffer_manager), pending_tasks(pending_tasks), hits(hits), blocks(std::move(blocks_p)) {
+	}
+	~RowGroupReadAheadTask() override {
+		pending_tasks--;
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			hits += buffer_manager.Prefetch(blocks);
+		} catch (std::exception &ex) {
+			// the read-ahead is best-effort: the scan will load (and report any errors for) the blocks itself
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	BufferManager &buffer_manager;
+	atomic<idx_t> &pending_tasks;
+	atomic<idx_t> &hits;
+	vector<shared_ptr<BlockHandle>> blocks;
+};
+
+RowGroupReadAhead::RowGroupReadAhead(DatabaseInstance &db)
+    : hits(0), scheduler(TaskScheduler::GetScheduler(db)), buffer_manager(BufferManager::GetBufferManager(db)),
+      token(scheduler.CreateProducer()), pending_tasks(0) {
+}
+
+RowGroupReadAhead::~RowGroupReadAhead() {
+	// remove the tasks that have not been picked up yet, and wait for the ones that are running to finish
+	shared_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*token, task)) {
+		task.reset();
+	}
+	while (pending_tasks > 0) {
+		TaskScheduler::YieldThread();
+	}
+}
+
+void RowGroupReadAhead::EnterRowGroup(RowGroup &row_group, CollectionScanState &state, idx_t depth) {
+	// any block of this row group that is not loaded yet is a block the read-ahead did not get to in time
+	PrefetchState current_state;
+	row_group.InitializePrefetch(state, current_state);
+	for (auto &block : current_state.blocks) {
+		if (block->IsUnloaded()) {
+			misses++;
+		}
+	}
+	if (scheduler.NumberOfThreads() <= 1) {
+		// there are no background threads to read ahead with - load the blocks of this row group in one go instead
+		// these blocks were already counted as misses above, so they do not count as hits of the read-ahead
+		buffer_manager.Prefetch(current_state.blocks);
+		return;
+	}
+	PrefetchState prefetch_state;
+	auto next = state.row_groups->GetNextSegment(&row_group);
+	for (idx_t i = 0; i < depth && next && next->start < state.max_row; i++) {
+		if (next->start >= requested_end) {
+			next->InitializePrefetch(state, prefetch_state);
+			requested_end = next->start + next->count;
+		}
+		next = state.row_groups->GetNextSegment(next);
+	}
+	if (prefetch_state.blocks.empty()) {
+		return;
+	}
+	pending_tasks++;
+	scheduler.ScheduleTask(*token, make_shared_ptr<RowGroupReadAheadTask>(buffer_manager, pending_tasks, hits,
+	                                                                       std::move(prefetch_state.blocks)));
+}
+
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
     : row_group(nullptr), vector_index(0), max_row_group_row(0), row_groups(nullptr), max_row(0), batch_index(0),
-      parent(parent_p) {
+      pruned_row_groups(0), parent(parent_p) {
 }
 
 bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result) {
@@ -1,4 +1,5 @@
 #include "duckdb/storage/table/standard_column_data.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -76,6 +77,25 @@ idx_t StandardColumnData::Scan(TransactionData transaction, idx_t vector_index,
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	// try to evaluate the filter on the compressed data first, so we only materialize rows that can match
+	idx_t scan_count;
+	if (!ScanVectorFiltered(vector_index, state, result, sel, count, filter, scan_count)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	if (count == 0) {
+		validity.Skip(state.child_states[0], scan_count);
+		return;
+	}
+	validity.Scan(transaction, vector_index, state.child_states[0], result);
+	// the compressed filter only prunes rows - apply the full filter to the remaining rows
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, count);
+}
+
 idx_t StandardColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result,
                                         bool allow_updates) {
 	D_ASSERT(state.row_index == state.child_states[0].row_index);
@@ -170,6 +190,15 @@ void StandardColumnData::CommitDropColumn() {
 	validity.CommitDropColumn();
 }
 
+bool StandardColumnData::HasChanges() {
+	return ColumnData::HasChanges() || validity.HasChanges();
+}
+
+void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state) {
+	ColumnData::InitializePrefetch(prefetch_state);
+	validity.InitializePrefetch(prefetch_state);
+}
+
 struct StandardColumnCheckpointState : public ColumnCheckpointState {
 	StandardColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
 	                              PartialBlockManager &partial_block_manager)
@@ -177,6 +206,7 @@ struct StandardColumnCheckpointState : public ColumnCheckpointState {
 	}
 
 	unique_ptr<ColumnCheckpointState> validity_state;
+	shared_ptr<BloomFilter> bloom_filter;
 
 public:
 	unique_ptr<BaseStatistics> GetStatistics() override {
@@ -188,6 +218,7 @@ public:
 		ColumnCheckpointState::WriteDataPointers(writer, serializer);
 		serializer.WriteObject(101, "validity",
 		                       [&](Serializer &serializer) { validity_state->WriteDataPointers(writer, serializer); });
+		serializer.WritePropertyWithDefault(102, "bloom_filter", bloom_filter);
 	}
 };
 
@@ -207,6 +238,7 @@ unique_ptr<ColumnCheckpointState> StandardColumnData::Checkpoint(RowGroup &row_g
 	auto validity_state = validity.Checkpoint(row_group, checkpoint_info);
 	auto &checkpoint_state = base_state->Cast<StandardColumnCheckpointState>();
 	checkpoint_state.validity_state = std::move(validity_state);
+	checkpoint_state.bloom_filter = GetBloomFilter();
 	return base_state;
 }
 
@@ -222,6 +254,10 @@ void StandardColumnData::DeserializeColumn(Deserializer &deserializer, BaseStati
 	ColumnData::DeserializeColumn(deserializer, target_stats);
 	deserializer.ReadObject(
 	    101, "validity", [&](Deserializer &deserializer) { validity.DeserializeColumn(deserializer, target_stats); });
+	auto filter = deserializer.ReadPropertyWithDefault<shared_ptr<BloomFilter>>(102, "bloom_filter");
+	if (filter) {
+		SetBloomFilter(std::move(filter));
+	}
 }
 
 void StandardColumnData::GetColumnSegmentInfo(duckdb::idx_t row_group_index, vector<duckdb::idx_t> col_path,
@@ -252,6 +252,25 @@ void StructColumnData::CommitDropColumn() {
 	}
 }
 
+bool StructColumnData::HasChanges() {
+	if (validity.HasChanges()) {
+		return true;
+	}
+	for (auto &sub_column : sub_columns) {
+		if (sub_column->HasChanges()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void StructColumnData::InitializePrefetch(PrefetchState &prefetch_state) {
+	validity.InitializePrefetch(prefetch_state);
+	for (auto &sub_column : sub_columns) {
+		sub_column->InitializePrefetch(prefetch_state);
+	}
+}
+
 struct StructColumnCheckpointState : public ColumnCheckpointState {
 	StructColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
 	                            PartialBlockManager &partial_block_manager)
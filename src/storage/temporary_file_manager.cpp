@@ -1,6 +1,8 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "duckdb/main/config.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -8,10 +10,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +61,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +68,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +96,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, idx_t slot_size) {
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// files with compressed buffers are named after the size of their slots
+	return "duckdb_temp_storage_" + to_string(slot_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), slot_size(slot_size), db(db),
+      file_index(index),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, slot_size))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,16 +128,39 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		D_ASSERT(!compressed_buffer.get());
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	D_ASSERT(compressed_buffer.GetSize() >= slot_size);
+	handle->Write(compressed_buffer.get(), slot_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, GetPositionInFile(block_index), Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	}
+	// read the compressed buffer: the compressed size, followed by the compressed data
+	auto compressed_buffer = buffer_manager.GetIOAllocator().Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	if (compressed_size > slot_size - sizeof(idx_t)) {
+		throw IOException("Corrupt temporary file \"%s\": invalid compressed buffer size %llu", path, compressed_size);
+	}
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_zstd::ZSTD_decompress(
+	    buffer->buffer, buffer->size, compressed_buffer.get() + sizeof(idx_t), compressed_size);
+	if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != Storage::BLOCK_SIZE) {
+		throw IOException("Corrupt temporary file \"%s\": failed to decompress buffer", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -163,6 +197,10 @@ void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 	}
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto open_flags = FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE;
+	if (DBConfig::GetConfig(db).options.use_direct_io) {
+		// the slots of temporary files are aligned to the sector size, as are the buffers that are written to them
+		open_flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+	}
 	handle = fs.OpenFile(path, open_flags);
 }
 
@@ -180,7 +218,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -276,16 +314,52 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
-void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto &config = DBConfig::GetConfig(db);
+	if (config.options.temp_file_compression == TemporaryFileCompression::NONE) {
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	D_ASSERT(config.options.temp_file_compression == TemporaryFileCompression::ZSTD);
+	// spilling is on the critical path of the query: use the fastest regular compression level
+	static constexpr int COMPRESSION_LEVEL = 1;
+
+	auto bound = duckdb_zstd::ZSTD_compressBound(buffer.size);
+	auto target = BufferManager::GetBufferManager(db).GetIOAllocator().Allocate(sizeof(idx_t) + bound);
+	auto compressed_size = duckdb_zstd::ZSTD_compress(target.get() + sizeof(idx_t), bound, buffer.buffer, buffer.size,
+	                                                  COMPRESSION_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		throw InternalException("Failed to compress temporary buffer: %s",
+		                        duckdb_zstd::ZSTD_getErrorName(compressed_size));
+	}
+	auto slot_size = AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(sizeof(idx_t) + compressed_size);
+	if (slot_size >= Storage::BLOCK_ALLOC_SIZE) {
+		// the buffer does not compress well enough to save any space: write it uncompressed
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	D_ASSERT(target.GetSize() >= slot_size);
+	Store<idx_t>(compressed_size, target.get());
+	memset(target.get() + sizeof(idx_t) + compressed_size, 0, slot_size - sizeof(idx_t) - compressed_size);
+	compressed_buffer = std::move(target);
+	return slot_size;
+}
+
+idx_t TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(buffer, compressed_buffer);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
-
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the right slot size
+		idx_t slot_size_file_count = 0;
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
+			slot_size_file_count++;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,7 +369,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file = make_uniq<TemporaryFileHandle>(slot_size_file_count, db, temp_directory, new_file_index,
+			                                               *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -306,7 +381,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
+	return slot_size;
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -363,8 +439,8 @@ void TemporaryFileManager::DecreaseSizeOnDisk(idx_t bytes) {
 	size_on_disk -= bytes;
 }
 
-unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
-                                                                 unique_ptr<FileBuffer> reusable_buffer) {
+unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer,
+                                                                 idx_t &size_on_disk) {
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle;
 	{
@@ -372,6 +448,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
+	size_on_disk = handle->GetSlotSize();
 	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
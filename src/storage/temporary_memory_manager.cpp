@@ -1,14 +1,25 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
+QueryMemoryAdmission::QueryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager_p,
+                                           ClientContext &context_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p) {
+}
+
+QueryMemoryAdmission::~QueryMemoryAdmission() {
+	temporary_memory_manager.ReleaseAdmission(context);
+}
+
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           QueryMemoryState &query_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), query(query_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0) {
 }
 
@@ -34,7 +45,8 @@ idx_t TemporaryMemoryState::GetReservation() const {
 	return reservation;
 }
 
-TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0) {
+TemporaryMemoryManager::TemporaryMemoryManager()
+    : reservation(0), remaining_size(0), next_admission_ticket(0), admitted_budget(0) {
 }
 
 unique_lock<mutex> TemporaryMemoryManager::Lock() {
@@ -55,13 +67,110 @@ TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 	return BufferManager::GetBufferManager(context).GetTemporaryMemoryManager();
 }
 
+static idx_t GetQueryMemoryLimit(ClientContext &context) {
+	// the limit of the connection takes precedence over the global limit
+	auto limit = context.config.query_memory_limit;
+	if (limit == DConstants::INVALID_INDEX) {
+		limit = DBConfig::GetConfig(context).options.query_memory_limit;
+	}
+	if (limit >= DConstants::INVALID_INDEX - 1) {
+		// no limit
+		return DConstants::INVALID_INDEX;
+	}
+	return limit;
+}
+
+QueryMemoryState &TemporaryMemoryManager::GetQueryState(ClientContext &context, const string &query) {
+	auto entry = queries.find(context);
+	if (entry == queries.end()) {
+		entry = queries.emplace(context, QueryMemoryState(context, query)).first;
+		entry->second.memory_limit = GetQueryMemoryLimit(context);
+	}
+	return entry->second;
+}
+
+void TemporaryMemoryManager::TryRemoveQueryState(ClientContext &context) {
+	auto entry = queries.find(context);
+	if (entry != queries.end() && !entry->second.active && entry->second.state_count == 0) {
+		queries.erase(entry);
+	}
+}
+
+unique_ptr<QueryMemoryAdmission> TemporaryMemoryManager::AdmitQuery(ClientContext &context, const string &query) {
+	auto guard = Lock();
+	UpdateConfiguration(context);
+
+	// a context runs a single query at a time
+	TryRemoveQueryState(context);
+	auto &query_state = GetQueryState(context, query);
+	query_state.query = query;
+	query_state.memory_limit = GetQueryMemoryLimit(context);
+	query_state.active = true;
+	if (query_state.memory_limit == DConstants::INVALID_INDEX) {
+		// queries without a budget are admitted right away
+		query_state.admitted = true;
+		return make_uniq<QueryMemoryAdmission>(*this, context);
+	}
+
+	// wait in line until the budget of the query fits next to the budgets of the admitted queries
+	// a query whose budget exceeds the memory limit is admitted as soon as no other queries with a budget are running
+	auto budget = MinValue<idx_t>(query_state.memory_limit, memory_limit);
+	auto ticket = next_admission_ticket++;
+	admission_queue.push_back(ticket);
+	while (admission_queue.front() != ticket || (admitted_budget > 0 && admitted_budget + budget > memory_limit)) {
+		if (context.interrupted) {
+			admission_queue.erase(std::find(admission_queue.begin(), admission_queue.end(), ticket));
+			query_state.active = false;
+			TryRemoveQueryState(context);
+			admission_cv.notify_all();
+			throw InterruptException();
+		}
+		// wake up periodically to check whether the query was interrupted
+		admission_cv.wait_for(guard, std::chrono::milliseconds(10));
+	}
+	admission_queue.pop_front();
+	admitted_budget += budget;
+	query_state.admitted_budget = budget;
+	query_state.admitted = true;
+	// the next query in line might fit as well
+	admission_cv.notify_all();
+	return make_uniq<QueryMemoryAdmission>(*this, context);
+}
+
+void TemporaryMemoryManager::ReleaseAdmission(ClientContext &context) {
+	auto guard = Lock();
+	auto entry = queries.find(context);
+	D_ASSERT(entry != queries.end());
+	auto &query_state = entry->second;
+	D_ASSERT(admitted_budget >= query_state.admitted_budget);
+	admitted_budget -= query_state.admitted_budget;
+	query_state.admitted_budget = 0;
+	query_state.active = false;
+	TryRemoveQueryState(context);
+	admission_cv.notify_all();
+}
+
+vector<QueryMemoryInformation> TemporaryMemoryManager::GetQueryInformation() {
+	auto guard = Lock();
+	vector<QueryMemoryInformation> result;
+	for (auto &entry : queries) {
+		auto &query_state = entry.second;
+		result.push_back({query_state.query, query_state.memory_limit, query_state.reservation,
+		                  query_state.remaining_size, query_state.state_count, query_state.admitted});
+	}
+	return result;
+}
+
 unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context) {
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
+	auto &query_state = GetQueryState(context, string());
+	auto query_memory_limit = MinValue(memory_limit, query_state.memory_limit);
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
-	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	                                    query_memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, query_state, minimum_reservation));
+	query_state.state_count++;
 	SetRemainingSize(*result, result->minimum_reservation);
 	SetReservation(*result, result->minimum_reservation);
 	active_states.insert(*result);
@@ -90,9 +199,16 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// 4. The part of the memory budget of the query that is not reserved by its other states
 		auto upper_bound = MinValue<idx_t>(temporary_memory_state.remaining_size, query_max_memory);
 		auto free_memory = memory_limit - (reservation - temporary_memory_state.reservation);
 		upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * free_memory));
+		auto &query = temporary_memory_state.query;
+		if (query.memory_limit != DConstants::INVALID_INDEX) {
+			auto query_reservation = query.reservation - temporary_memory_state.reservation;
+			auto query_free_memory = query.memory_limit > query_reservation ? query.memory_limit - query_reservation : 0;
+			upper_bound = MinValue<idx_t>(upper_bound, query_free_memory);
+		}
 
 		if (remaining_size > memory_limit) {
 			// We're processing more data than fits in memory, so we must further limit memory usage.
@@ -111,15 +227,19 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
 	D_ASSERT(this->remaining_size >= temporary_memory_state.remaining_size);
 	this->remaining_size -= temporary_memory_state.remaining_size;
+	temporary_memory_state.query.remaining_size -= temporary_memory_state.remaining_size;
 	temporary_memory_state.remaining_size = new_remaining_size;
 	this->remaining_size += temporary_memory_state.remaining_size;
+	temporary_memory_state.query.remaining_size += temporary_memory_state.remaining_size;
 }
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.reservation);
 	this->reservation -= temporary_memory_state.reservation;
+	temporary_memory_state.query.reservation -= temporary_memory_state.reservation;
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.reservation;
+	temporary_memory_state.query.reservation += temporary_memory_state.reservation;
 }
 
 void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_state) {
@@ -128,6 +248,8 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	SetReservation(temporary_memory_state, 0);
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
+	temporary_memory_state.query.state_count--;
+	TryRemoveQueryState(temporary_memory_state.query.context);
 
 	Verify();
 }
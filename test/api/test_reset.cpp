@@ -58,6 +58,8 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_force_external", {Value(true)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"enable_join_filter_pushdown", {Value(false)}},
+	    {"enable_join_role_reversal", {Value(false)}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"default_secret_storage", {"custom_storage"}},
@@ -74,6 +76,8 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"autoinstall_known_extensions", {true}},
 #endif
 	    {"enable_fsst_vectors", {true}},
+	    {"enable_row_group_bloom_filters", {true}},
+	    {"scan_read_ahead_depth", {Value::UBIGINT(4)}},
 	    {"enable_object_cache", {true}},
 	    {"enable_profiling", {"json"}},
 	    {"enable_progress_bar", {true}},
@@ -95,14 +99,23 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"perfect_ht_threshold", {0}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
+	    {"partitioned_hash_join_threshold", {"1.0 GiB"}},
 	    {"partitioned_write_flush_threshold", {123}},
 	    {"preserve_identifier_case", {false}},
 	    {"preserve_insertion_order", {false}},
+	    {"mmap_read_only", {true}},
+	    {"slab_allocator", {true}},
+	    {"background_eviction", {true}},
+	    {"background_eviction_high_watermark", {0.75}},
+	    {"background_eviction_low_watermark", {0.5}},
 	    {"profile_output", {"test"}},
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {"zstd"}},
+	    {"eviction_policy", {"2q"}},
+	    {"query_memory_limit", {"1.0 GiB"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
 	    {"enable_http_metadata_cache", {true}},
@@ -138,6 +151,8 @@ bool OptionIsExcludedFromTest(const string &name) {
 	    "external_threads", // tested in test_threads.cpp
 	    "profiling_output", // just an alias
 	    "duckdb_api",
+	    "numa_aware_scheduling", // cant change this while db is running
+	    "direct_io",             // cant change this while db is running
 	    "custom_user_agent"};
 	return excluded_options.count(name) == 1;
 }
@@ -115,3 +115,71 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+TEST_CASE("Test NUMA-aware scheduling", "[api]") {
+	DBConfig config;
+	config.SetOptionByName("numa_aware_scheduling", Value::BOOLEAN(true));
+	config.options.maximum_threads = 8;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+	REQUIRE(db.NumberOfThreads() == 8);
+
+	auto result = con.Query("SELECT current_setting('numa_aware_scheduling')");
+	REQUIRE(CHECK_COLUMN(result, 0, {true}));
+
+	// the tasks of parallel queries are executed by the threads of all nodes
+	for (idx_t i = 0; i < 3; i++) {
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM (SELECT DISTINCT i FROM range(1000000) t(i))");
+		REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(499999500000)}));
+	}
+	con.Query("SET threads=2");
+	REQUIRE(db.NumberOfThreads() == 2);
+	result = con.Query("SELECT COUNT(*) FROM range(1000000) t1(i) JOIN range(1000000) t2(i) USING (i)");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+
+	// the setting can only be changed when the database is started
+	auto res = con.Query("SET numa_aware_scheduling=false");
+	REQUIRE(res->HasError());
+}
+
+static void RunWorkStealingQueries(DuckDB *db, bool *correct) {
+	Connection con(*db);
+	for (idx_t i = 0; i < 20; i++) {
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM (SELECT DISTINCT i FROM range(100000) t(i))");
+		if (!CHECK_COLUMN(result, 0, {100000}) || !CHECK_COLUMN(result, 1, {Value::HUGEINT(4999950000)})) {
+			*correct = false;
+		}
+	}
+}
+
+TEST_CASE("Test scheduling tasks on the deques of the worker threads", "[api]") {
+	DBConfig config;
+	config.options.maximum_threads = 8;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+
+	// many short queries that run concurrently
+	const idx_t thread_count = 8;
+	bool correct[thread_count];
+	std::vector<std::thread> threads;
+	for (idx_t i = 0; i < thread_count; i++) {
+		correct[i] = true;
+		threads.emplace_back(RunWorkStealingQueries, &db, correct + i);
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	for (idx_t i = 0; i < thread_count; i++) {
+		REQUIRE(correct[i]);
+	}
+
+	// the tasks of a query that fails are removed from the deques of the workers
+	for (idx_t i = 0; i < 5; i++) {
+		auto result = con.Query("SELECT COUNT(*) FROM range(2000000) t1(i) JOIN range(2000000) t2(i) USING (i) "
+		                        "WHERE CASE WHEN t1.i = 1000000 THEN error('stop') ELSE true END");
+		REQUIRE(result->HasError());
+		result = con.Query("SELECT COUNT(*) FROM range(1000000) t1(i) JOIN range(1000000) t2(i) USING (i)");
+		REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+	}
+}
@@ -97,6 +97,41 @@ TEST_CASE("Test file operations", "[file_system]") {
 	fs->RemoveFile(fname);
 }
 
+TEST_CASE("Test batched file reads", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	duckdb::unique_ptr<FileHandle> handle;
+	int64_t test_data[INTEGER_COUNT];
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		test_data[i] = i;
+	}
+
+	auto fname = TestCreatePath("test_batch_file");
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE));
+	REQUIRE_NOTHROW(handle->Write((void *)test_data, sizeof(int64_t) * INTEGER_COUNT, 0));
+	handle.reset();
+
+	// read every integer with a separate request - in reverse order and more requests than fit in a single batch
+	int64_t read_data[INTEGER_COUNT];
+	duckdb::vector<FileReadRequest> requests;
+	for (idx_t i = 0; i < INTEGER_COUNT; i++) {
+		auto index = INTEGER_COUNT - i - 1;
+		requests.emplace_back(read_data + index, sizeof(int64_t), index * sizeof(int64_t));
+	}
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ));
+	REQUIRE_NOTHROW(handle->ReadBatch(requests));
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		REQUIRE(read_data[i] == i);
+	}
+
+	// reading past the end of the file fails
+	requests.clear();
+	requests.emplace_back(read_data, sizeof(int64_t), 0);
+	requests.emplace_back(read_data + 1, sizeof(int64_t), INTEGER_COUNT * sizeof(int64_t));
+	REQUIRE_THROWS(handle->ReadBatch(requests));
+	handle.reset();
+	fs->RemoveFile(fname);
+}
+
 TEST_CASE("absolute paths", "[file_system]") {
 	duckdb::LocalFileSystem fs;
 
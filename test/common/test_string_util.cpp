@@ -198,6 +198,10 @@ TEST_CASE("Test split quoted strings", "[string_util]") {
 		REQUIRE(StringUtil::SplitWithQuote("x,\"y\",z") == duckdb::vector<string> {"x", "y", "z"});
 	}
 
+	SECTION("Three items, with spaces around the delimiter") {
+		REQUIRE(StringUtil::SplitWithQuote("x, \"y\" ,  z") == duckdb::vector<string> {"x", "y", "z"});
+	}
+
 	SECTION("Even more items, with and without quote") {
 		REQUIRE(StringUtil::SplitWithQuote("a,b,c,d,e,f,g") ==
 		        duckdb::vector<string> {"a", "b", "c", "d", "e", "f", "g"});
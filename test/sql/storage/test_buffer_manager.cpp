@@ -330,3 +330,52 @@ TEST_CASE("Test buffer allocator", "[storage][.]") {
 
 	allocator.FreeData(pointer, current_size);
 }
+
+TEST_CASE("Test direct I/O for database files and temporary files", "[storage][.]") {
+	duckdb::unique_ptr<MaterializedQueryResult> result;
+	auto storage_database = TestCreatePath("direct_io_test");
+	auto temp_directory = TestCreatePath("direct_io_temp");
+	auto config = GetTestConfig();
+	config->options.use_direct_io = true;
+	config->options.maximum_memory = 16ULL * 1024ULL * 1024ULL;
+	config->options.maximum_threads = 1;
+	config->options.temporary_directory = temp_directory;
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT current_setting('direct_io')");
+		REQUIRE(CHECK_COLUMN(result, 0, {true}));
+		REQUIRE_FAIL(con.Query("SET direct_io=false"));
+
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE t AS SELECT i, i::VARCHAR AS s FROM range(1000000) t(i)"));
+		REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+		// spill to the temporary directory, both uncompressed and compressed
+		for (auto compression : {"none", "zstd"}) {
+			REQUIRE_NO_FAIL(con.Query(StringUtil::Format("SET temp_file_compression='%s'", compression)));
+			result = con.Query("SELECT COUNT(*), SUM(i) FROM (SELECT DISTINCT i, s FROM t)");
+			REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+			REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(499999500000)}));
+		}
+	}
+	{
+		// reload the database with direct I/O
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i), MAX(s) FROM t");
+		REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(499999500000)}));
+		REQUIRE(CHECK_COLUMN(result, 2, {"999999"}));
+	}
+	{
+		// and without
+		config->options.use_direct_io = false;
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM t");
+		REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(499999500000)}));
+	}
+	DeleteDatabase(storage_database);
+}
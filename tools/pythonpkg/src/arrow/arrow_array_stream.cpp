@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -328,6 +329,15 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 			throw NotImplementedException("Comparison Type can't be an Arrow Scan Pushdown Filter");
 		}
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		py::list constant_values;
+		for (auto &value : in_filter.values) {
+			constant_values.append(GetScalar(value, timezone_config, type));
+		}
+		return constant_field.attr("isin")(constant_values);
+	}
 	//! We do not pushdown is null yet
 	case TableFilterType::IS_NULL: {
 		auto constant_field = field(py::tuple(py::cast(column_ref)));